@@ -0,0 +1,53 @@
+/**
+ * @file    dirty.h
+ * @brief   Dirty rectangle tracking and minimal redraw of the screen.
+ * @date    16 paź 2026
+ * @author  agent
+ *
+ * @verbatim
+ * Copyright (c) 2026 agent.
+ * All rights reserved. This program and the
+ * accompanying materials are made available
+ * under the terms of the GNU Public License
+ * v3.0 which accompanies this distribution,
+ * and is available at
+ * http://www.gnu.org/licenses/gpl.html
+ * @endverbatim
+ */
+#ifndef INC_DIRTY_H_
+#define INC_DIRTY_H_
+
+#include <inttypes.h>
+
+/**
+ * @defgroup  DIRTY DIRTY
+ * @brief     Dirty rectangle tracking and minimal redraw of the screen
+ */
+
+/**
+ * @addtogroup DIRTY
+ * @{
+ */
+
+/**
+ * @brief Counters of the dirty rectangle manager.
+ */
+typedef struct {
+  uint32_t invalidatedPixels; ///< Sum of areas passed to DIRTY_Invalidate()
+  uint32_t redrawnPixels;     ///< Sum of areas passed to the redraw callback
+  uint32_t rectsInvalidated;  ///< Number of DIRTY_Invalidate() calls
+  uint32_t rectsRedrawn;      ///< Number of redraw callback calls
+  uint32_t merges;            ///< Number of merged rectangle pairs
+} DIRTY_Stats;
+
+void DIRTY_SetRedraw  (void (*redraw)(int x, int y, int w, int h));
+void DIRTY_Invalidate (int x, int y, int w, int h);
+void DIRTY_Flush      (void);
+void DIRTY_GetStats   (DIRTY_Stats* stats);
+void DIRTY_ResetStats (void);
+
+/**
+ * @}
+ */
+
+#endif /* INC_DIRTY_H_ */
@@ -35,6 +35,7 @@ int8_t FAT_Init(void (*phyInit)(void),
     uint8_t (*phyWriteSectors)(uint8_t* buf, uint32_t sector, uint32_t count));
 
 int FAT_OpenFile(const char* filename);
+int FAT_CloseFile(int file);
 int FAT_ReadFile(int file, uint8_t* data, int count);
 int FAT_MoveRdPtr(int file, int newWrPtr);
 int FAT_MoveWrPtr(int file, int newWrPtr);
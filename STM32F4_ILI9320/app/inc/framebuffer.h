@@ -0,0 +1,52 @@
+/**
+ * @file    framebuffer.h
+ * @brief   Off-screen 8 bpp framebuffer with RGB565 palette.
+ * @date    16 paź 2026
+ * @author  agent
+ *
+ * @verbatim
+ * Copyright (c) 2026 agent.
+ * All rights reserved. This program and the
+ * accompanying materials are made available
+ * under the terms of the GNU Public License
+ * v3.0 which accompanies this distribution,
+ * and is available at
+ * http://www.gnu.org/licenses/gpl.html
+ * @endverbatim
+ */
+#ifndef INC_FRAMEBUFFER_H_
+#define INC_FRAMEBUFFER_H_
+
+#include <inttypes.h>
+#include <ili9320.h>
+
+/**
+ * @defgroup  FB FB
+ * @brief     Off-screen 8 bpp framebuffer with RGB565 palette
+ */
+
+/**
+ * @addtogroup FB
+ * @{
+ */
+
+#define FB_WIDTH  ILI9320_WIDTH                 ///< Width of framebuffer
+#define FB_HEIGHT ILI9320_HEIGHT                ///< Height of framebuffer
+#define FB_SIZE   (FB_WIDTH * FB_HEIGHT)        ///< Size of framebuffer memory in bytes (75 KB)
+
+void      FB_Init           (uint8_t* buf);
+void      FB_SetPalette     (uint8_t index, uint16_t color);
+uint16_t  FB_GetPalette     (uint8_t index);
+uint8_t   FB_MatchColor     (uint16_t color);
+void      FB_PutPixel       (int x, int y, uint8_t index);
+void      FB_FillRect       (int x, int y, int w, int h, uint8_t index);
+void      FB_WriteRow       (int x, int y, const uint16_t* buf, int n);
+void      FB_Invalidate     (int x, int y, int w, int h);
+void      FB_Flush          (void);
+void      FB_FlushRect      (int x, int y, int w, int h);
+
+/**
+ * @}
+ */
+
+#endif /* INC_FRAMEBUFFER_H_ */
@@ -0,0 +1,42 @@
+/**
+ * @file    glyph_cache.h
+ * @brief   Cache of font characters expanded to RGB565.
+ * @date    16 paź 2026
+ * @author  agent
+ *
+ * @verbatim
+ * Copyright (c) 2026 agent.
+ * All rights reserved. This program and the
+ * accompanying materials are made available
+ * under the terms of the GNU Public License
+ * v3.0 which accompanies this distribution,
+ * and is available at
+ * http://www.gnu.org/licenses/gpl.html
+ * @endverbatim
+ */
+#ifndef INC_GLYPH_CACHE_H_
+#define INC_GLYPH_CACHE_H_
+
+#include <inttypes.h>
+#include <graphics.h>
+
+/**
+ * @defgroup  GLYPH_CACHE GLYPH_CACHE
+ * @brief     Cache of font characters expanded to RGB565
+ */
+
+/**
+ * @addtogroup GLYPH_CACHE
+ * @{
+ */
+
+const uint16_t* GLYPH_CacheGet(const GRAPH_FontStruct* font, uint8_t c,
+    uint16_t fg, uint16_t bg);
+void GLYPH_CacheClear(void);
+void GLYPH_CacheGetStats(uint32_t* hits, uint32_t* misses);
+
+/**
+ * @}
+ */
+
+#endif /* INC_GLYPH_CACHE_H_ */
@@ -30,6 +30,20 @@
  * @{
  */
 
+#define GRAPH_MAX_PINS  2  ///< Number of pinned regions (one at each edge of the screen)
+#define GRAPH_MAX_EDGES 32 ///< Maximum number of vertices of a filled polygon
+
+/**
+ * @brief Color in the format of the LCD (RGB565).
+ */
+typedef uint16_t GRAPH_Color;
+
+/**
+ * @brief Converts 8 bit RGB components to GRAPH_Color.
+ */
+#define GRAPH_RGB(r, g, b) \
+  ((GRAPH_Color)((((r) & 0xf8) << 8) | (((g) & 0xfc) << 3) | (((b) & 0xff) >> 3)))
+
 /**
  * @brief Structure containing information about
  * a font.
@@ -41,6 +55,10 @@
  * column corresponds to the LSB of the first byte, so the MSB bits
  * of the last byte may not be used.
  *
+ * On the screen a font column is a row of pixels (along the X axis)
+ * and the next columns are below it, which is the order in which
+ * the LCD fills a window, so a character is sent as a single burst.
+ *
  * TODO Ignore the MSB bits of last byte - this isn't very problematic
  * since for now we draw strings from top to bottom.
  *
@@ -53,22 +71,116 @@ typedef struct {
   uint8_t numberOfChars;  ///< Number of characters in font
 } GRAPH_FontStruct;
 
+/**
+ * @brief Formats of image pixels.
+ */
+typedef enum {
+  GRAPH_IMAGE_RGB888, ///< 3 bytes per pixel - red, green and blue
+  GRAPH_IMAGE_RGB565, ///< GRAPH_Color per pixel - sent to the LCD as is
+  GRAPH_IMAGE_RLE565, ///< Runs of GRAPH_Color (uint16_t data)
+  GRAPH_IMAGE_RLE8,   ///< Runs of palette indices (uint8_t data)
+  GRAPH_IMAGE_INDEX1, ///< Palette indices, 1 bit per pixel
+  GRAPH_IMAGE_INDEX2, ///< Palette indices, 2 bits per pixel
+  GRAPH_IMAGE_INDEX4, ///< Palette indices, 4 bits per pixel
+  GRAPH_IMAGE_INDEX8, ///< Palette indices, 8 bits per pixel
+} GRAPH_ImageFormat;
+
+/**
+ * @brief Structure containing information about
+ * an image.
+ *
+ * @details Pixels are stored row by row, starting with the top left
+ * corner. RGB565 images (see tools/imgconv) are sent to the LCD
+ * without conversion and take a third less flash than RGB888 ones.
+ *
+ * RLE images are a sequence of packets, each starting with a header
+ * which gives the number of pixels n and the type of packet. A run
+ * packet has a single color, repeated n times, a literal packet
+ * has n colors. Packets continue over the ends of rows.
+ *
+ * - RLE565 - the header is a word: bit 15 set for a run,
+ *   bits 0-14 are n - 1. Colors are GRAPH_Color words.
+ * - RLE8 - the header is a byte: bit 7 set for a run, bits 0-5
+ *   are n - 1. If bit 6 is set, they are the upper bits of n - 1
+ *   and the next byte holds the lower 8 bits. Colors are indices
+ *   of the palette.
+ *
+ * Indexed images (INDEX1 - INDEX8) are packed bytes of palette
+ * indices, the first pixel in the most significant bits. Every row
+ * starts with a new byte. Icons with few colors take a half (16 colors)
+ * down to a sixteenth (2 colors) of an RGB565 image. When transparent
+ * is set, pixels with index key are not drawn, so the background
+ * stays visible around the icon.
+ *
+ * The palette of an INDEX1 - INDEX4 image has to hold 2^bits colors
+ * (2, 4 or 16) even if fewer indices are used - the expansion table
+ * is built from all of them. INDEX8 and RLE8 palettes only need the
+ * used indices.
+ */
+typedef struct {
+  const void* data;           ///< Image data (uint16_t array for RGB565 and RLE565)
+  uint16_t rows;              ///< Number of pixel rows
+  uint16_t columns;           ///< Number of pixel columns
+  GRAPH_ImageFormat format;   ///< Format of pixels
+  const GRAPH_Color* palette; ///< Colors of indices (RLE8 and indexed images)
+  uint8_t transparent;        ///< 1 - pixels with index key are not drawn (indexed images)
+  uint8_t key;                ///< Transparent index
+} GRAPH_ImageStruct;
+
+/**
+ * @brief Point on the screen.
+ */
+typedef struct {
+  uint16_t x; ///< X coordinate
+  uint16_t y; ///< Y coordinate
+} GRAPH_PointStruct;
 
 void GRAPH_DrawRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
 void GRAPH_DrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+void GRAPH_DrawHLine(uint16_t x, uint16_t y, uint16_t len);
+void GRAPH_DrawVLine(uint16_t x, uint16_t y, uint16_t len);
+void GRAPH_DrawThickLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+    uint8_t width);
+void GRAPH_DrawPolyline(const GRAPH_PointStruct* points, uint16_t n,
+    uint8_t width);
+void GRAPH_DrawFilledTriangle(uint16_t x1, uint16_t y1, uint16_t x2,
+    uint16_t y2, uint16_t x3, uint16_t y3);
+int  GRAPH_DrawFilledPolygon(const GRAPH_PointStruct* points, uint16_t n);
 void GRAPH_Init(void);
 void GRAPH_SetColor(uint8_t r, uint8_t g, uint8_t b);
+void GRAPH_SetColor565(GRAPH_Color color);
 void GRAPH_DrawBox(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t lineWidth);
 void GRAPH_DrawCircle(uint16_t x0, uint16_t y0, uint16_t radius);
 void GRAPH_DrawFilledCircle(uint16_t x, uint16_t y, uint16_t radius);
+void GRAPH_DrawFilledEllipse(uint16_t x, uint16_t y, uint16_t rx, uint16_t ry);
+void GRAPH_DrawRoundedRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+    uint16_t radius);
+void GRAPH_DrawRoundedBox(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+    uint16_t radius);
 void GRAPH_DrawString(const char* s, uint16_t x, uint16_t y);
 void GRAPH_DrawChar(uint8_t c, uint16_t x, uint16_t y);
 void GRAPH_SetBgColor(uint8_t r, uint8_t g, uint8_t b);
+void GRAPH_SetBgColor565(GRAPH_Color color);
+void GRAPH_SetDither(uint8_t enable);
 void GRAPH_ClrScreen(uint8_t r, uint8_t g, uint8_t b);
-void GRAPH_DrawImage(uint16_t x, uint16_t y);
+void GRAPH_DrawImage(const GRAPH_ImageStruct* img, uint16_t x, uint16_t y);
+int  GRAPH_DrawBmpFile(const char* name, uint16_t x, uint16_t y);
+int  GRAPH_DrawJpegFile(const char* name, uint16_t x, uint16_t y,
+    uint8_t scale);
 void GRAPH_DrawGraph(const uint8_t* data, uint16_t len, uint16_t x, uint16_t y);
 void GRAPH_DrawBarChart(const uint8_t* data, uint16_t len, uint16_t x, uint16_t y, uint16_t width);
 void GRAPH_SetFont(GRAPH_FontStruct font);
+void GRAPH_SetFramebuffer(uint8_t* buf);
+void GRAPH_Flush(void);
+void GRAPH_SetBand(uint16_t* buf, int y, int h);
+void GRAPH_SetClip(int x, int y, int w, int h);
+void GRAPH_ResetClip(void);
+int  GRAPH_PushViewport(int x, int y, int w, int h);
+int  GRAPH_PopViewport(void);
+int  GRAPH_Scroll(int lines);
+int  GRAPH_PinRegion(uint8_t n, int x, int w);
+void GRAPH_UnpinRegion(uint8_t n);
+void GRAPH_GetUnpinned(int* x, int* w);
 
 /**
  * @}
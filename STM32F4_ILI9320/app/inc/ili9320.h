@@ -30,10 +30,57 @@
  * @{
  */
 
+#define ILI9320_WIDTH   320 ///< Width of the display in pixels (X axis)
+#define ILI9320_HEIGHT  240 ///< Height of the display in pixels (Y axis)
+#define ILI9320_VSYNC_LINES 32 ///< Lines sent at a time behind the scan line
+
+/**
+ * @brief Counters of the register shadow.
+ */
+typedef struct {
+  uint32_t regIssued;   ///< Register writes sent to the LCD
+  uint32_t regElided;   ///< Register writes skipped (value unchanged)
+  uint32_t indexIssued; ///< Index register writes sent to the LCD
+  uint32_t indexElided; ///< Index register writes skipped (already selected)
+} ILI9320_RegStats;
+
 void ILI9320_Initializtion(void);
 void ILI9320_SetWindow(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
 void ILI9320_DrawPixel(uint16_t x, uint16_t y, uint8_t r, uint8_t g, uint8_t b);
+void ILI9320_DrawPixelColor(uint16_t x, uint16_t y, uint16_t color);
 uint16_t ILI9320_RGBDecode(uint8_t r, uint8_t g, uint8_t b);
+uint32_t ILI9320_CalibrateTiming(void);
+
+void ILI9320_WriteBegin(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+void ILI9320_WriteBeginBottomUp(uint16_t x, uint16_t y, uint16_t width,
+    uint16_t height);
+void ILI9320_WritePush(uint16_t color);
+void ILI9320_WritePixels(const uint16_t* buf, uint32_t n);
+void ILI9320_WriteFill(uint16_t color, uint32_t n);
+void ILI9320_WriteEnd(void);
+void ILI9320_WritePixelsAsync(const uint16_t* buf, uint32_t n, void (*cb)(void));
+void ILI9320_WriteFillAsync(uint16_t color, uint32_t n, void (*cb)(void));
+uint8_t ILI9320_TransferBusy(void);
+void ILI9320_WaitTransfer(void);
+void ILI9320_ReadPixels(uint16_t x, uint16_t y, uint16_t width,
+    uint16_t height, uint16_t* buf);
+
+void ILI9320_SetScroll(uint16_t lines);
+uint16_t ILI9320_GetScroll(void);
+uint16_t ILI9320_GetScrollSeam(void);
+void ILI9320_SetPartialImage(uint8_t image, uint16_t pos,
+    uint16_t start, uint16_t end);
+void ILI9320_EnablePartialImage(uint8_t image, uint8_t enable);
+
+int ILI9320_VsyncInit(uint8_t interval);
+uint32_t ILI9320_GetFramePeriod(void);
+uint32_t ILI9320_GetFrame(void);
+int ILI9320_GetScanLine(void);
+void ILI9320_WaitScanOutside(uint16_t x, uint16_t width);
+uint32_t ILI9320_WaitFrame(uint8_t frames);
+
+void ILI9320_GetRegStats(ILI9320_RegStats* stats);
+void ILI9320_ResetRegStats(void);
 
 /**
  * @}
@@ -0,0 +1,51 @@
+/**
+ * @file    jpeg.h
+ * @brief   Baseline JPEG decoder.
+ * @date    16 paź 2026
+ * @author  agent
+ *
+ * @verbatim
+ * Copyright (c) 2026 agent.
+ * All rights reserved. This program and the
+ * accompanying materials are made available
+ * under the terms of the GNU Public License
+ * v3.0 which accompanies this distribution,
+ * and is available at
+ * http://www.gnu.org/licenses/gpl.html
+ * @endverbatim
+ */
+#ifndef INC_JPEG_H_
+#define INC_JPEG_H_
+
+#include <inttypes.h>
+
+/**
+ * @defgroup  JPEG JPEG
+ * @brief     Baseline JPEG decoder
+ */
+
+/**
+ * @addtogroup JPEG
+ * @{
+ */
+
+#define JPEG_MAX_MCU 16 ///< Largest width and height of MCU in pixels
+
+/**
+ * @brief Function receiving decoded blocks of pixels.
+ *
+ * @details A block is w x h pixels (RGB565), stored row by row.
+ * x and y are the coordinates of the block in the (scaled) image.
+ * The pixels stay unchanged until the function returns for the next
+ * block, so they may still be sent by DMA meanwhile.
+ */
+typedef void (*JPEG_OutputCb)(int x, int y, int w, int h,
+    const uint16_t* pixels);
+
+int JPEG_Decode(int file, uint8_t scale, JPEG_OutputCb output);
+
+/**
+ * @}
+ */
+
+#endif /* INC_JPEG_H_ */
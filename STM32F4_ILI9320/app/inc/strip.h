@@ -0,0 +1,50 @@
+/**
+ * @file    strip.h
+ * @brief   Band renderer of a display list.
+ * @date    16 paź 2026
+ * @author  agent
+ *
+ * @verbatim
+ * Copyright (c) 2026 agent.
+ * All rights reserved. This program and the
+ * accompanying materials are made available
+ * under the terms of the GNU Public License
+ * v3.0 which accompanies this distribution,
+ * and is available at
+ * http://www.gnu.org/licenses/gpl.html
+ * @endverbatim
+ */
+#ifndef INC_STRIP_H_
+#define INC_STRIP_H_
+
+#include <inttypes.h>
+#include <graphics.h>
+
+/**
+ * @defgroup  STRIP STRIP
+ * @brief     Band renderer of a display list
+ */
+
+/**
+ * @addtogroup STRIP
+ * @{
+ */
+
+#define STRIP_BAND_HEIGHT 16  ///< Number of rows in a band
+
+void STRIP_Clear      (uint8_t r, uint8_t g, uint8_t b);
+int  STRIP_SetColor   (uint8_t r, uint8_t g, uint8_t b);
+int  STRIP_SetBgColor (uint8_t r, uint8_t g, uint8_t b);
+int  STRIP_SetFont    (const GRAPH_FontStruct* font);
+int  STRIP_AddRect    (uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+int  STRIP_AddLine    (uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+int  STRIP_AddCircle  (uint16_t x, uint16_t y, uint16_t radius);
+int  STRIP_AddString  (const char* s, uint16_t x, uint16_t y);
+int  STRIP_AddImage   (const GRAPH_ImageStruct* img, uint16_t x, uint16_t y);
+void STRIP_Render     (void);
+
+/**
+ * @}
+ */
+
+#endif /* INC_STRIP_H_ */
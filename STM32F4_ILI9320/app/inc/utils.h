@@ -31,8 +31,8 @@
  */
 
 void hexdump(const uint8_t* buf, uint32_t length);
-void hexdumpC(const uint8_t const *buf, uint32_t length);
-void hexdump16C(const uint16_t const *buf, uint32_t length);
+void hexdumpC(const uint8_t* buf, uint32_t length);
+void hexdump16C(const uint16_t* buf, uint32_t length);
 uint32_t ntohl(uint32_t val);
 uint8_t isBigEndian(void);
 
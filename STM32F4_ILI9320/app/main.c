@@ -33,6 +33,7 @@
 #include <fat.h>
 #include <sdcard.h>
 #include <utils.h>
+#include <example_bmp.h>
 
 #define SYSTICK_FREQ 1000 ///< Frequency of the SysTick set at 1kHz.
 #define COMM_BAUD_RATE 115200UL ///< Baud rate for communication with PC
@@ -104,7 +105,7 @@ int main(void) {
   // draw image test
   TIMER_Delay(3000);
   GRAPH_ClrScreen(0, 0, 0);
-  GRAPH_DrawImage(30, 30);
+  GRAPH_DrawImage(&example_bmpImage, 30, 30);
 
   // data for example graph - sinusoidal signal
   uint8_t graphData[320];
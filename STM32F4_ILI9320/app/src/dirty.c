@@ -0,0 +1,272 @@
+/**
+ * @file    dirty.c
+ * @brief   Dirty rectangle tracking and minimal redraw of the screen.
+ * @date    16 paź 2026
+ * @author  agent
+ *
+ * @details Changed areas of the screen are collected with
+ * DIRTY_Invalidate() and redrawn with DIRTY_Flush(), which calls
+ * the redraw callback once for every dirty rectangle, from top
+ * to bottom. The callback repaints the given area of the scene -
+ * for example the GUI redraws its widgets, and with the off-screen
+ * framebuffer it can simply be FB_FlushRect().
+ *
+ * Two rectangles are merged when redrawing their bounding box
+ * costs no more than redrawing them separately. Every redraw is
+ * assumed to cost DIRTY_RECT_COST pixels more than its area
+ * (setting the window, calling the widgets), so close rectangles
+ * are merged even if a few pixels are redrawn needlessly.
+ * Overlapping rectangles are always merged, whatever the cost, so
+ * no pixel is drawn twice - unless the list of rectangles is full
+ * (see DIRTY_Invalidate()).
+ *
+ * @verbatim
+ * Copyright (c) 2026 agent.
+ * All rights reserved. This program and the
+ * accompanying materials are made available
+ * under the terms of the GNU Public License
+ * v3.0 which accompanies this distribution,
+ * and is available at
+ * http://www.gnu.org/licenses/gpl.html
+ * @endverbatim
+ */
+
+#include <dirty.h>
+#include <ili9320.h>
+#include <graphics.h>
+#include <string.h>
+
+/**
+ * @addtogroup DIRTY
+ * @{
+ */
+
+#define DIRTY_MAX_RECTS 16  ///< Maximum number of dirty rectangles
+#define DIRTY_RECT_COST 64  ///< Cost of a single redraw in pixels (besides its area)
+
+/**
+ * @brief Dirty rectangle.
+ */
+typedef struct {
+  int x; ///< X coordinate of top left corner
+  int y; ///< Y coordinate of top left corner
+  int w; ///< Width
+  int h; ///< Height
+} DIRTY_RectTypeDef;
+
+static DIRTY_RectTypeDef rects[DIRTY_MAX_RECTS]; ///< Dirty rectangles
+static uint8_t rectCount;                        ///< Number of dirty rectangles
+static void (*redrawCb)(int x, int y, int w, int h); ///< Redraw callback
+static DIRTY_Stats stats;                        ///< Counters
+
+static DIRTY_RectTypeDef DIRTY_Union(const DIRTY_RectTypeDef* a,
+    const DIRTY_RectTypeDef* b);
+static int32_t DIRTY_MergeCost(const DIRTY_RectTypeDef* a,
+    const DIRTY_RectTypeDef* b);
+static uint8_t DIRTY_Overlap(const DIRTY_RectTypeDef* a,
+    const DIRTY_RectTypeDef* b);
+
+/**
+ * @brief Sets the function which repaints an area of the screen.
+ * @param redraw Redraw callback.
+ */
+void DIRTY_SetRedraw(void (*redraw)(int x, int y, int w, int h)) {
+
+  redrawCb = redraw;
+}
+/**
+ * @brief Marks an area of the screen as changed.
+ *
+ * @details The rectangle is clipped to the part of the screen which
+ * is not pinned (see GRAPH_PinRegion()) and merged with
+ * the already collected ones which it overlaps or which are cheaper
+ * to redraw together with it. When the list is full, the rectangle
+ * is merged with the one which gives the smallest bounding box.
+ *
+ * @param x X coordinate of area
+ * @param y Y coordinate of area
+ * @param w Width of area
+ * @param h Height of area
+ */
+void DIRTY_Invalidate(int x, int y, int w, int h) {
+
+  DIRTY_RectTypeDef r;
+  int32_t cost, bestCost;
+  uint8_t best;
+  uint8_t i;
+  int x0, width;
+
+  GRAPH_GetUnpinned(&x0, &width);
+
+  // clip to screen
+  if (x < x0) {
+    w -= x0 - x;
+    x = x0;
+  }
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  if (x + w > x0 + width) {
+    w = x0 + width - x;
+  }
+  if (y + h > ILI9320_HEIGHT) {
+    h = ILI9320_HEIGHT - y;
+  }
+  if (w <= 0 || h <= 0) {
+    return;
+  }
+
+  stats.rectsInvalidated++;
+  stats.invalidatedPixels += (uint32_t)w * h;
+
+  r.x = x;
+  r.y = y;
+  r.w = w;
+  r.h = h;
+
+  // merging can make the rectangle overlap others, so start over
+  // after every merge
+  i = 0;
+  while (i < rectCount) {
+    if (DIRTY_Overlap(&rects[i], &r) ||
+        DIRTY_MergeCost(&rects[i], &r) <= DIRTY_RECT_COST) {
+      r = DIRTY_Union(&rects[i], &r);
+      rects[i] = rects[--rectCount];
+      stats.merges++;
+      i = 0;
+    } else {
+      i++;
+    }
+  }
+
+  if (rectCount == DIRTY_MAX_RECTS) {
+    best = 0;
+    bestCost = DIRTY_MergeCost(&rects[0], &r);
+    for (i = 1; i < rectCount; i++) {
+      cost = DIRTY_MergeCost(&rects[i], &r);
+      if (cost < bestCost) {
+        bestCost = cost;
+        best = i;
+      }
+    }
+    r = DIRTY_Union(&rects[best], &r);
+    rects[best] = rects[--rectCount];
+    stats.merges++;
+    // the bounding box may now overlap other rectangles,
+    // but drawing them twice is better than losing one
+  }
+
+  rects[rectCount++] = r;
+}
+/**
+ * @brief Redraws all dirty rectangles.
+ *
+ * @details Rectangles are redrawn from top to bottom (by Y, then X).
+ * The callback may invalidate new areas - they are redrawn by
+ * the next flush.
+ */
+void DIRTY_Flush(void) {
+
+  DIRTY_RectTypeDef list[DIRTY_MAX_RECTS];
+  DIRTY_RectTypeDef tmp;
+  uint8_t count = rectCount;
+  int i, j;
+
+  memcpy(list, rects, count * sizeof(DIRTY_RectTypeDef));
+  rectCount = 0;
+
+  // insertion sort - there are only a few rectangles
+  for (i = 1; i < count; i++) {
+    tmp = list[i];
+    j = i - 1;
+    while (j >= 0 && (list[j].y > tmp.y ||
+        (list[j].y == tmp.y && list[j].x > tmp.x))) {
+      list[j + 1] = list[j];
+      j--;
+    }
+    list[j + 1] = tmp;
+  }
+
+  if (!redrawCb) {
+    return;
+  }
+
+  for (i = 0; i < count; i++) {
+    stats.rectsRedrawn++;
+    stats.redrawnPixels += (uint32_t)list[i].w * list[i].h;
+    redrawCb(list[i].x, list[i].y, list[i].w, list[i].h);
+  }
+}
+/**
+ * @brief Reads the counters.
+ * @param s Structure to fill.
+ */
+void DIRTY_GetStats(DIRTY_Stats* s) {
+
+  *s = stats;
+}
+/**
+ * @brief Clears the counters.
+ */
+void DIRTY_ResetStats(void) {
+
+  memset(&stats, 0, sizeof(stats));
+}
+/**
+ * @brief Calculates the bounding box of two rectangles.
+ * @param a First rectangle
+ * @param b Second rectangle
+ * @return Bounding box
+ */
+static DIRTY_RectTypeDef DIRTY_Union(const DIRTY_RectTypeDef* a,
+    const DIRTY_RectTypeDef* b) {
+
+  DIRTY_RectTypeDef u;
+  const int x1 = (a->x + a->w > b->x + b->w) ? a->x + a->w : b->x + b->w;
+  const int y1 = (a->y + a->h > b->y + b->h) ? a->y + a->h : b->y + b->h;
+
+  u.x = (a->x < b->x) ? a->x : b->x;
+  u.y = (a->y < b->y) ? a->y : b->y;
+  u.w = x1 - u.x;
+  u.h = y1 - u.y;
+
+  return u;
+}
+/**
+ * @brief Calculates the cost of merging two rectangles.
+ *
+ * @details The cost is the number of pixels the bounding box has
+ * over the two rectangles drawn separately. It is zero for adjacent
+ * rectangles which form a rectangle. It may be negative for
+ * overlapping ones (their common part counts twice), but it is not
+ * for all of them - two crossing bars have a large bounding box.
+ *
+ * @param a First rectangle
+ * @param b Second rectangle
+ * @return Additional pixels redrawn if rectangles are merged.
+ */
+static int32_t DIRTY_MergeCost(const DIRTY_RectTypeDef* a,
+    const DIRTY_RectTypeDef* b) {
+
+  const DIRTY_RectTypeDef u = DIRTY_Union(a, b);
+
+  return (int32_t)u.w * u.h - (int32_t)a->w * a->h - (int32_t)b->w * b->h;
+}
+/**
+ * @brief Checks if two rectangles have common pixels.
+ * @param a First rectangle
+ * @param b Second rectangle
+ * @retval 1 Rectangles overlap
+ * @retval 0 Rectangles are apart (or only touch)
+ */
+static uint8_t DIRTY_Overlap(const DIRTY_RectTypeDef* a,
+    const DIRTY_RectTypeDef* b) {
+
+  return a->x < b->x + b->w && b->x < a->x + a->w &&
+      a->y < b->y + b->h && b->y < a->y + a->h;
+}
+
+/**
+ * @}
+ */
@@ -519,8 +519,8 @@ int FAT_MoveRdPtr(int file, int newWrPtr) {
     return -1; // EOF for not open file
   }
 
-  // Can't move beyond length of file for read
-  if (newWrPtr > openedFiles[file].fileSize) {
+  // Can't move before the start or beyond length of file for read
+  if (newWrPtr < 0 || (uint32_t)newWrPtr > openedFiles[file].fileSize) {
     println("%s: EOF reached", __FUNCTION__);
     return -1;
   }
@@ -818,7 +818,7 @@ static int FAT_GetCluster(uint32_t firstCluster, uint32_t clusterOffset,
     uint32_t* clusterNumber) {
 
   uint32_t entry = firstCluster;
-  int i;
+  uint32_t i;
 
   for (i = 0; i < clusterOffset; i++) {
     entry = FAT_GetEntryInFAT(entry);
@@ -872,7 +872,7 @@ static uint32_t FAT_GetEntryInFAT(uint32_t cluster) {
 
   // the byte number of the entry in the given sector is the remainder
   // of the previous calculation
-  uint8_t offset = (cluster*4) % mountedDisks[0].partitionInfo[0].bytesPerSector;
+  uint32_t offset = (cluster*4) % mountedDisks[0].partitionInfo[0].bytesPerSector;
 
   // the 4-byte entry is at offset
   uint32_t* ret = (uint32_t*)(buf+offset);
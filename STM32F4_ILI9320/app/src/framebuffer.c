@@ -0,0 +1,365 @@
+/**
+ * @file    framebuffer.c
+ * @brief   Off-screen 8 bpp framebuffer with RGB565 palette.
+ * @date    16 paź 2026
+ * @author  agent
+ *
+ * @details A full RGB565 frame (150 KB) does not fit in RAM,
+ * but an 8 bpp one (75 KB) does. Every pixel is an index to
+ * a 256 color RGB565 palette. Drawing only changes memory and
+ * marks the changed area as dirty. FB_Flush() expands the dirty
+ * area through the palette and sends it to the LCD in one window.
+ *
+ * The default palette is RGB332 (3 bits of red, 3 of green and
+ * 2 of blue). RGB565 colors are converted to indices through a
+ * lookup table indexed by the RGB332 value of the color, which
+ * holds the nearest palette entry. The table is rebuilt after
+ * the palette is changed.
+ *
+ * The memory for the framebuffer is given by the user, so it is
+ * only reserved by applications which use it.
+ *
+ * @verbatim
+ * Copyright (c) 2026 agent.
+ * All rights reserved. This program and the
+ * accompanying materials are made available
+ * under the terms of the GNU Public License
+ * v3.0 which accompanies this distribution,
+ * and is available at
+ * http://www.gnu.org/licenses/gpl.html
+ * @endverbatim
+ */
+
+#include <framebuffer.h>
+#include <string.h>
+
+/**
+ * @addtogroup FB
+ * @{
+ */
+
+static uint8_t* fb;                     ///< Framebuffer memory (FB_SIZE bytes)
+static uint16_t palette[256];           ///< RGB565 palette
+static uint8_t inverse[256];            ///< Nearest palette entry for every RGB332 color
+static uint8_t inverseValid;            ///< Is the inverse table up to date?
+static uint16_t line[2][FB_WIDTH];      ///< Expanded rows - one is sent while the next is expanded
+
+static int dirtyX0; ///< Dirty area - left edge
+static int dirtyY0; ///< Dirty area - top edge
+static int dirtyX1; ///< Dirty area - right edge (inclusive)
+static int dirtyY1; ///< Dirty area - bottom edge (inclusive)
+
+static void FB_BuildInverse(void);
+static uint8_t FB_ClipRect(int* x, int* y, int* w, int* h);
+
+/**
+ * @brief Converts RGB565 color to RGB332.
+ */
+#define FB_RGB565_TO_332(c) ((((c) >> 8) & 0xe0) | (((c) >> 6) & 0x1c) | (((c) >> 3) & 0x03))
+
+/**
+ * @brief Initializes the framebuffer.
+ *
+ * @details Sets the default RGB332 palette and clears the
+ * framebuffer to index 0 (black).
+ *
+ * @param buf Framebuffer memory - FB_SIZE bytes.
+ */
+void FB_Init(uint8_t* buf) {
+
+  uint8_t r, g, b;
+
+  fb = buf;
+
+  for (int i = 0; i < 256; i++) {
+    r = (i >> 5) & 0x07;
+    g = (i >> 2) & 0x07;
+    b = i & 0x03;
+    palette[i] = ((r * 31 / 7) << 11) | ((g * 63 / 7) << 5) | (b * 31 / 3);
+  }
+  inverseValid = 0;
+
+  memset(fb, 0, FB_SIZE);
+  dirtyX0 = FB_WIDTH;
+  dirtyY0 = FB_HEIGHT;
+  dirtyX1 = -1;
+  dirtyY1 = -1;
+}
+/**
+ * @brief Sets a palette entry.
+ *
+ * @details Pixels using this entry change color on the next flush
+ * of the area they are in.
+ *
+ * @param index Palette index.
+ * @param color Color (RGB565).
+ */
+void FB_SetPalette(uint8_t index, uint16_t color) {
+
+  palette[index] = color;
+  inverseValid = 0;
+}
+/**
+ * @brief Reads a palette entry.
+ * @param index Palette index.
+ * @return Color (RGB565).
+ */
+uint16_t FB_GetPalette(uint8_t index) {
+
+  return palette[index];
+}
+/**
+ * @brief Finds the palette entry for a color.
+ * @param color Color (RGB565).
+ * @return Palette index.
+ */
+uint8_t FB_MatchColor(uint16_t color) {
+
+  if (!inverseValid) {
+    FB_BuildInverse();
+  }
+
+  return inverse[FB_RGB565_TO_332(color)];
+}
+/**
+ * @brief Sets a pixel.
+ * @param x X coordinate
+ * @param y Y coordinate
+ * @param index Palette index.
+ */
+void FB_PutPixel(int x, int y, uint8_t index) {
+
+  if (x < 0 || y < 0 || x >= FB_WIDTH || y >= FB_HEIGHT) {
+    return;
+  }
+
+  fb[y * FB_WIDTH + x] = index;
+  FB_Invalidate(x, y, 1, 1);
+}
+/**
+ * @brief Fills a rectangle.
+ * @param x X coordinate of start point
+ * @param y Y coordinate of start point
+ * @param w Width
+ * @param h Height
+ * @param index Palette index.
+ */
+void FB_FillRect(int x, int y, int w, int h, uint8_t index) {
+
+  if (!FB_ClipRect(&x, &y, &w, &h)) {
+    return;
+  }
+
+  FB_Invalidate(x, y, w, h);
+
+  uint8_t* ptr = fb + y * FB_WIDTH + x;
+
+  if (w == FB_WIDTH) {
+    memset(ptr, index, w * h);
+    return;
+  }
+
+  while (h--) {
+    memset(ptr, index, w);
+    ptr += FB_WIDTH;
+  }
+}
+/**
+ * @brief Writes a row of RGB565 pixels.
+ *
+ * @details Every pixel is converted to the nearest palette entry.
+ *
+ * @param x X coordinate of first pixel
+ * @param y Y coordinate of row
+ * @param buf Pixels (RGB565)
+ * @param n Number of pixels
+ */
+void FB_WriteRow(int x, int y, const uint16_t* buf, int n) {
+
+  int h = 1;
+  const int x0 = x;
+
+  if (!FB_ClipRect(&x, &y, &n, &h)) {
+    return;
+  }
+
+  if (!inverseValid) {
+    FB_BuildInverse();
+  }
+
+  FB_Invalidate(x, y, n, 1);
+
+  uint8_t* ptr = fb + y * FB_WIDTH + x;
+  buf += x - x0; // skip clipped pixels
+
+  while (n--) {
+    *ptr++ = inverse[FB_RGB565_TO_332(*buf)];
+    buf++;
+  }
+}
+/**
+ * @brief Marks an area as changed.
+ *
+ * @details The dirty area is the bounding box of all changed areas.
+ *
+ * @param x X coordinate of start point
+ * @param y Y coordinate of start point
+ * @param w Width
+ * @param h Height
+ */
+void FB_Invalidate(int x, int y, int w, int h) {
+
+  if (!FB_ClipRect(&x, &y, &w, &h)) {
+    return;
+  }
+
+  if (x < dirtyX0) {
+    dirtyX0 = x;
+  }
+  if (y < dirtyY0) {
+    dirtyY0 = y;
+  }
+  if (x + w - 1 > dirtyX1) {
+    dirtyX1 = x + w - 1;
+  }
+  if (y + h - 1 > dirtyY1) {
+    dirtyY1 = y + h - 1;
+  }
+}
+/**
+ * @brief Sends the dirty area to the LCD.
+ */
+void FB_Flush(void) {
+
+  if (dirtyX1 < dirtyX0 || dirtyY1 < dirtyY0) {
+    return; // nothing changed
+  }
+
+  FB_FlushRect(dirtyX0, dirtyY0, dirtyX1 - dirtyX0 + 1, dirtyY1 - dirtyY0 + 1);
+
+  dirtyX0 = FB_WIDTH;
+  dirtyY0 = FB_HEIGHT;
+  dirtyX1 = -1;
+  dirtyY1 = -1;
+}
+/**
+ * @brief Sends an area of the framebuffer to the LCD.
+ *
+ * @details Rows are expanded through the palette and sent by DMA
+ * while the next row is expanded. The dirty area is not changed.
+ * When the LCD driver is synchronized to FMARK, the area is sent
+ * in pieces right behind the scan line, so it is not torn.
+ *
+ * @param x X coordinate of start point
+ * @param y Y coordinate of start point
+ * @param w Width
+ * @param h Height
+ */
+void FB_FlushRect(int x, int y, int w, int h) {
+
+  const uint8_t* src;
+  uint16_t* dst;
+
+  const int seam = ILI9320_GetScrollSeam();
+
+  if (!FB_ClipRect(&x, &y, &w, &h)) {
+    return;
+  }
+
+  // the parts left and right of the scroll seam are apart in GRAM
+  if (x < seam && seam < x + w) {
+    FB_FlushRect(x, y, seam - x, h);
+    FB_FlushRect(seam, y, x + w - seam, h);
+    return;
+  }
+
+  if (w > ILI9320_VSYNC_LINES && ILI9320_GetScanLine() >= 0) {
+    for (int i = 0; i < w; i += ILI9320_VSYNC_LINES) {
+      FB_FlushRect(x + i, y, (w - i < ILI9320_VSYNC_LINES) ?
+          w - i : ILI9320_VSYNC_LINES, h);
+    }
+    return;
+  }
+
+  ILI9320_WaitTransfer(); // line buffers may still be in use
+  ILI9320_WaitScanOutside(x, w);
+
+  ILI9320_WriteBegin(x, y, w, h);
+
+  for (int i = 0; i < h; i++) {
+    src = fb + (y + i) * FB_WIDTH + x;
+    dst = line[i & 1];
+    for (int j = 0; j < w; j++) {
+      dst[j] = palette[src[j]];
+    }
+    // waits for the previous row to be sent
+    ILI9320_WritePixelsAsync(dst, w, 0);
+  }
+
+  ILI9320_WriteEnd();
+}
+/**
+ * @brief Finds the nearest palette entry for every RGB332 color.
+ */
+static void FB_BuildInverse(void) {
+
+  int r, g, b, dr, dg, db;
+  uint32_t dist, best;
+
+  for (int i = 0; i < 256; i++) {
+    // RGB332 color expanded to 5/6/5 bits
+    r = ((i >> 5) & 0x07) * 31 / 7;
+    g = ((i >> 2) & 0x07) * 63 / 7;
+    b = (i & 0x03) * 31 / 3;
+
+    best = UINT32_MAX;
+
+    for (int j = 0; j < 256; j++) {
+      dr = ((palette[j] >> 11) & 0x1f) - r;
+      dg = (((palette[j] >> 5) & 0x3f) - g) / 2; // green has one bit more
+      db = (palette[j] & 0x1f) - b;
+      dist = dr * dr + dg * dg + db * db;
+      if (dist < best) {
+        best = dist;
+        inverse[i] = j;
+        if (dist == 0) {
+          break;
+        }
+      }
+    }
+  }
+
+  inverseValid = 1;
+}
+/**
+ * @brief Clips a rectangle to the framebuffer.
+ * @param x X coordinate of start point
+ * @param y Y coordinate of start point
+ * @param w Width
+ * @param h Height
+ * @retval 1 Part of rectangle is inside the framebuffer
+ * @retval 0 Rectangle is outside of the framebuffer
+ */
+static uint8_t FB_ClipRect(int* x, int* y, int* w, int* h) {
+
+  if (*x < 0) {
+    *w += *x;
+    *x = 0;
+  }
+  if (*y < 0) {
+    *h += *y;
+    *y = 0;
+  }
+  if (*x + *w > FB_WIDTH) {
+    *w = FB_WIDTH - *x;
+  }
+  if (*y + *h > FB_HEIGHT) {
+    *h = FB_HEIGHT - *y;
+  }
+
+  return *w > 0 && *h > 0;
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,161 @@
+/**
+ * @file    glyph_cache.c
+ * @brief   Cache of font characters expanded to RGB565.
+ * @date    16 paź 2026
+ * @author  agent
+ *
+ * @details Characters are cached fully expanded to foreground and
+ * background colors, in the order in which they are sent to the LCD,
+ * so drawing a cached character is a single burst write. The expanded
+ * characters are kept in the 64 KB CCM RAM (section .ccmram of
+ * sections.ld), which is not used by anything else and leaves the main
+ * RAM to the framebuffer. CCM RAM is not cleared at startup - only the
+ * slot descriptions in the main RAM are - and it is not accessible by
+ * DMA, so cached characters are always written by the CPU.
+ *
+ * Every slot holds one character of any of the fonts. When all slots
+ * are used, the least recently used one is replaced.
+ *
+ * @verbatim
+ * Copyright (c) 2026 agent.
+ * All rights reserved. This program and the
+ * accompanying materials are made available
+ * under the terms of the GNU Public License
+ * v3.0 which accompanies this distribution,
+ * and is available at
+ * http://www.gnu.org/licenses/gpl.html
+ * @endverbatim
+ */
+
+#include <glyph_cache.h>
+#include <string.h>
+
+/**
+ * @addtogroup GLYPH_CACHE
+ * @{
+ */
+
+#define GLYPH_CACHE_SLOTS       30    ///< Number of cached characters (60 KB of CCM RAM)
+#define GLYPH_CACHE_SLOT_PIXELS 1024  ///< Maximum number of pixels in a character (21x39 font has 840)
+
+#define GLYPH_CCMRAM __attribute__((section(".ccmram"))) ///< Places variable in CCM RAM (see sections.ld)
+
+/**
+ * @brief Description of a cached character.
+ */
+typedef struct {
+  const uint8_t* font;  ///< Font data (identifies the font)
+  uint16_t fg;          ///< Foreground color
+  uint16_t bg;          ///< Background color
+  uint8_t c;            ///< Character (ASCII code)
+  uint8_t valid;        ///< Is the slot used?
+  uint32_t lastUse;     ///< Value of use counter at last access
+} GLYPH_SlotTypeDef;
+
+static uint16_t glyphData[GLYPH_CACHE_SLOTS][GLYPH_CACHE_SLOT_PIXELS] GLYPH_CCMRAM; ///< Expanded characters
+static GLYPH_SlotTypeDef slots[GLYPH_CACHE_SLOTS]; ///< Cached character descriptions
+static uint32_t useCounter; ///< Incremented on every access
+static uint32_t hits;       ///< Number of cache hits
+static uint32_t misses;     ///< Number of cache misses
+
+static void GLYPH_Expand(const GRAPH_FontStruct* font, uint8_t c,
+    uint16_t fg, uint16_t bg, uint16_t* out);
+
+/**
+ * @brief Returns a character expanded to RGB565.
+ *
+ * @details On a miss the character is expanded and stored in the
+ * least recently used slot. Pixels are returned row by row (every font
+ * column is a row of bytesPerColumn*8 pixels), which is the order of
+ * a GRAM window.
+ *
+ * @param font Font of character
+ * @param c Character (ASCII code) - has to exist in the font
+ * @param fg Foreground color (RGB565)
+ * @param bg Background color (RGB565)
+ * @return Expanded character or null if it does not fit in a slot.
+ */
+const uint16_t* GLYPH_CacheGet(const GRAPH_FontStruct* font, uint8_t c,
+    uint16_t fg, uint16_t bg) {
+
+  const uint32_t pixels = (uint32_t)font->columnCount * font->bytesPerColumn * 8;
+  uint8_t victim = 0;
+
+  if (pixels > GLYPH_CACHE_SLOT_PIXELS) {
+    return 0;
+  }
+
+  useCounter++;
+
+  for (int i = 0; i < GLYPH_CACHE_SLOTS; i++) {
+    if (!slots[i].valid) {
+      victim = i; // empty slots are used first
+      continue;
+    }
+    if (slots[i].c == c && slots[i].fg == fg && slots[i].bg == bg &&
+        slots[i].font == font->data) {
+      hits++;
+      slots[i].lastUse = useCounter;
+      return glyphData[i];
+    }
+    if (slots[victim].valid && slots[i].lastUse < slots[victim].lastUse) {
+      victim = i;
+    }
+  }
+
+  misses++;
+
+  GLYPH_Expand(font, c, fg, bg, glyphData[victim]);
+
+  slots[victim].font    = font->data;
+  slots[victim].c       = c;
+  slots[victim].fg      = fg;
+  slots[victim].bg      = bg;
+  slots[victim].valid   = 1;
+  slots[victim].lastUse = useCounter;
+
+  return glyphData[victim];
+}
+/**
+ * @brief Removes all characters from the cache.
+ */
+void GLYPH_CacheClear(void) {
+
+  memset(slots, 0, sizeof(slots));
+}
+/**
+ * @brief Reads cache statistics.
+ * @param h Number of cache hits.
+ * @param m Number of cache misses.
+ */
+void GLYPH_CacheGetStats(uint32_t* h, uint32_t* m) {
+
+  *h = hits;
+  *m = misses;
+}
+/**
+ * @brief Expands a character to RGB565.
+ * @param font Font of character
+ * @param c Character (ASCII code)
+ * @param fg Foreground color (RGB565)
+ * @param bg Background color (RGB565)
+ * @param out Output buffer
+ */
+static void GLYPH_Expand(const GRAPH_FontStruct* font, uint8_t c,
+    uint16_t fg, uint16_t bg, uint16_t* out) {
+
+  const uint16_t count = font->columnCount * font->bytesPerColumn;
+  const uint8_t* ptr = font->data + count * (uint8_t)(c - font->firstChar);
+  uint8_t bits;
+
+  for (int i = 0; i < count; i++) {
+    bits = *ptr++;
+    for (int k = 0; k < 8; k++, bits >>= 1) { // start from lowest bit
+      *out++ = (bits & 0x01) ? fg : bg;
+    }
+  }
+}
+
+/**
+ * @}
+ */
@@ -18,8 +18,11 @@
 #include <graphics.h>
 #include <ili9320.h>
 #include <string.h>
-#include <example_bmp.h>
 #include <font_8x16.h>
+#include <glyph_cache.h>
+#include <framebuffer.h>
+#include <fat.h>
+#include <jpeg.h>
 #include <math.h>
 
 /**
@@ -28,70 +31,289 @@
  */
 
 /**
- * @brief Structure containing information about
- * an image.
- *
- * @details The image is assumed to be structured in the following way.
- * Image data starts in the top right corner. The first three bytes are
- * the RGB bytes of the last column of the first row, next three bytes
- * are the second to last column of row 1, etc. After column 1 is reached
- * the next row starts.
+ * @brief Fills with at least this many pixels are done by DMA.
  *
+ * @details Smaller fills are faster when written by the CPU,
+ * since setting up the DMA costs more than the transfer itself.
  */
-typedef struct {
-  const uint8_t* data;    ///< Image data
-  uint16_t rows;          ///< Number of pixel rows
-  uint16_t columns;       ///< Number of pixel columns
-  uint8_t bytesPerPixel;  ///< Number of bytes per pixel
-} GRAPH_ImageStruct;
+#define GRAPH_DMA_FILL_MIN  256
+
+#define GRAPH_MAX_GLYPH_WIDTH 64 ///< Maximum number of pixels in a font column
+#define GRAPH_MAX_VIEWPORTS   8  ///< Depth of viewport stack
+#define GRAPH_MIN_RUN         3  ///< Shorter runs of pixels are drawn pixel by pixel
+#define GRAPH_BMP_HEADER      66 ///< Bytes of BMP headers read (with bit field masks)
+
 
 
 /**
  * @brief Currently set font.
  */
 static GRAPH_FontStruct currentFont;
+
 /**
- * @brief Example image to be drawn on screen.
+ * @brief Header of a BMP file.
+ *
+ * @details Fields of the file header, the info header and the bit
+ * field masks which follow it, read from the little endian file by
+ * GRAPH_ReadBmpHeader() (the file layout is not aligned).
  */
-static GRAPH_ImageStruct displayedImage = {
-    example_bmp,
-    192,
-    256,
-    3
-};
+typedef struct {
+  uint16_t signature;       ///< "BM"
+  uint32_t size;            ///< Size of file
+  uint32_t reserved;        ///< Reserved
+  uint32_t dataOffset;      ///< Offset of pixel data in file
+  uint32_t headerSize;      ///< Size of info header (the palette follows it)
+  int32_t width;            ///< Width in pixels
+  int32_t height;           ///< Height in pixels (negative - rows stored from the top)
+  uint16_t planes;          ///< Number of planes (1)
+  uint16_t bitsPerPixel;    ///< Bits per pixel
+  uint32_t compressionType; ///< 0 - none, 3 - bit fields
+  uint32_t imageSize;       ///< Size of pixel data
+  uint32_t resolutionH;     ///< Horizontal resolution (pixels per meter)
+  uint32_t resolutionV;     ///< Vertical resolution (pixels per meter)
+  uint32_t colorsInImage;   ///< Number of palette entries (0 - 2^bitsPerPixel)
+  uint32_t importantColors; ///< Number of important colors
+  uint32_t redMask;         ///< Red bits (bit fields)
+  uint32_t greenMask;       ///< Green bits (bit fields)
+  uint32_t blueMask;        ///< Blue bits (bit fields)
+} BMP_File;
+
+/**
+ * @brief Destination of drawing functions.
+ */
+typedef enum {
+  GRAPH_TARGET_LCD,   ///< Draw directly on the LCD
+  GRAPH_TARGET_FB,    ///< Draw to the off-screen framebuffer
+  GRAPH_TARGET_BAND,  ///< Draw to a band of full width rows in RAM
+} GRAPH_TargetTypeDef;
 
 /**
- * @brief Color structure
+ * @brief Band buffer set by GRAPH_SetBand().
  */
 typedef struct {
-  uint8_t r; ///< Red
-  uint8_t g; ///< Green
-  uint8_t b; ///< Blue
-} GRAPH_ColorStruct;
+  uint16_t* buf;  ///< Pixels (RGB565), ILI9320_WIDTH per row
+  int y;          ///< Y coordinate of the first row
+  int h;          ///< Number of rows
+} GRAPH_BandStruct;
 
 /**
- * @brief Structure for reading BMP files
+ * @brief Rectangle given by its edges (right and bottom edge excluded).
  */
 typedef struct {
-  uint16_t signature;
-  uint32_t size;
-  uint32_t reserved;
-  uint32_t dataOffset;
-  uint32_t headerSize;
-  uint32_t width;
-  uint32_t height;
-  uint32_t planes;
-  uint32_t bitsPerPixel;
-  uint32_t compressionType;
-  uint32_t imageSize;
-  uint32_t resolutionH;
-  uint32_t resolutionV;
-  uint32_t colorsInImage;
-  uint32_t importantColors;
-} BMP_File;
+  int x0; ///< Left edge
+  int y0; ///< Top edge
+  int x1; ///< Right edge (first column outside)
+  int y1; ///< Bottom edge (first row outside)
+} GRAPH_RectStruct;
+
+/**
+ * @brief Viewport - origin of coordinates and clip rectangle.
+ */
+typedef struct {
+  int ox;                   ///< X coordinate of origin on screen
+  int oy;                   ///< Y coordinate of origin on screen
+  GRAPH_RectStruct bounds;  ///< Area of viewport on screen
+  GRAPH_RectStruct clip;    ///< Clip rectangle on screen (inside bounds)
+} GRAPH_ViewportStruct;
+
+/**
+ * @brief Run of pixels collected by GRAPH_RunPixel().
+ */
+typedef struct {
+  int x;            ///< X coordinate of the leftmost (topmost) pixel
+  int y;            ///< Y coordinate of the leftmost (topmost) pixel
+  int n;            ///< Number of pixels (0 - no run)
+  uint8_t vertical; ///< Run along the Y axis (unknown for a single pixel)
+  uint16_t color;   ///< Color (RGB565)
+} GRAPH_RunStruct;
+
+/**
+ * @brief Polygon edge stepped by the scanline fillers.
+ *
+ * @details X is kept rounded down to 16.16 fixed point, with
+ * the remainder of the division in err, so stepping adds no error.
+ */
+typedef struct {
+  int32_t x;    ///< X at the center of the current row (16.16 fixed point)
+  int32_t dx;   ///< Change of X per row (rounded down)
+  uint32_t rem; ///< Remainder of change of X per row (in 1/den)
+  uint32_t err; ///< Remainder of X (in 1/den)
+  uint32_t den; ///< Height of edge (16.16 fixed point)
+  int first;    ///< First row crossed by the edge
+  int last;     ///< First row below the edge
+  int dir;      ///< 1 - edge goes down, -1 - edge goes up
+} GRAPH_EdgeStruct;
+
+/**
+ * @brief Window opened by GRAPH_BlitBegin().
+ */
+typedef struct {
+  int x;    ///< X coordinate of window
+  int y;    ///< Y coordinate of window
+  int w;    ///< Width of window
+  int col;  ///< Current column in window
+  int row;  ///< Current row in window
+  int step; ///< Change of row after each row (-1 - window filled from the bottom)
+} GRAPH_BlitStruct;
+
+/**
+ * @brief Table expanding bytes of indexed images to pixels.
+ *
+ * @details An entry holds the pixels of a byte value of INDEX4 (two
+ * pixels) or INDEX2 (four pixels) images, or of a nibble (four pixels,
+ * entries 0 - 15) of INDEX1 images. Pixels are paired in words, the
+ * first one in the lower half, so a word is stored to a row buffer
+ * at once. INDEX8 images use the palette itself.
+ */
+typedef struct {
+  const GRAPH_Color* palette; ///< Palette the table was built for (0 - none)
+  GRAPH_ImageFormat format;   ///< Format the table was built for
+  uint32_t pixels[256][2];    ///< Pairs of pixels of byte values
+} GRAPH_LutStruct;
+
+/**
+ * @brief Packet of an RLE image.
+ */
+typedef struct {
+  uint32_t n;          ///< Number of pixels
+  uint8_t isRun;       ///< 1 - run of a single color, 0 - literal pixels
+  uint16_t color;      ///< Color of run (RGB565)
+  const void* literal; ///< Colors (RLE565) or indices (RLE8) of literal pixels
+} GRAPH_RlePacketStruct;
+
+/**
+ * @brief Positions of the RLE decoder in the rows of an image drawn in pieces.
+ *
+ * @details When the LCD is synchronized to FMARK, images are drawn
+ * in pieces of ILI9320_VSYNC_LINES columns. Every piece continues in
+ * each row from the packet where the previous piece stopped, so the
+ * image is decoded once instead of once per piece.
+ */
+typedef struct {
+  const GRAPH_ImageStruct* img;    ///< Image drawn in pieces (0 - none)
+  int next;                        ///< First column of the next piece (-1 - no piece drawn yet)
+  const void* src[ILI9320_HEIGHT]; ///< Header of the packet holding column next, per visible row
+  uint32_t pos[ILI9320_HEIGHT];    ///< First pixel of that packet
+} GRAPH_RleResumeStruct;
+
+/**
+ * @brief Row of pixels converted from an image.
+ *
+ * @details Indexed images are expanded two pixels at a time,
+ * past the end of the visible part of row.
+ */
+typedef union {
+  uint32_t w[(ILI9320_WIDTH + 16) / 2]; ///< Pairs of pixels
+  uint16_t h[ILI9320_WIDTH + 16];       ///< Pixels (RGB565)
+} GRAPH_LineUnion;
 
-static GRAPH_ColorStruct currentColor;    ///< Global color
-static GRAPH_ColorStruct currentBgColor;  ///< Global background color
+static GRAPH_Color currentColor;          ///< Global color
+static GRAPH_Color currentBgColor;        ///< Global background color
+static uint8_t dither;                    ///< Images are dithered to RGB565
+static GRAPH_TargetTypeDef target;       ///< Destination of drawing
+static GRAPH_TargetTypeDef bandSaved;    ///< Destination of drawing before a band was selected
+static GRAPH_BandStruct band;             ///< Band buffer
+static GRAPH_BlitStruct blit;             ///< Currently opened blit window
+static GRAPH_RunStruct run;               ///< Pixels waiting to be drawn as a run
+static int jpegX;                         ///< X coordinate of JPEG image on screen
+static int jpegY;                         ///< Y coordinate of JPEG image on screen
+static GRAPH_LutStruct lut;               ///< Expansion table of the last indexed palette
+static GRAPH_LineUnion lineBuf[2];        ///< Converted rows of images - one is sent while the next is converted
+static GRAPH_RleResumeStruct rleResume;   ///< RLE decoder positions between pieces of an image
+static uint16_t bmpPalette[256];          ///< Palette of the drawn BMP file (RGB565)
+static uint8_t bmpRaw[ILI9320_WIDTH * 3]; ///< Row read from the BMP file
+static int32_t polyX[GRAPH_MAX_EDGES];    ///< X coordinates of vertices of the filled polygon
+static int32_t polyY[GRAPH_MAX_EDGES];    ///< Y coordinates of vertices of the filled polygon
+static GRAPH_EdgeStruct polyEdges[GRAPH_MAX_EDGES];   ///< Edge table of the filled polygon
+static GRAPH_EdgeStruct* polyActive[GRAPH_MAX_EDGES]; ///< Edges crossing the current row
+
+/**
+ * @brief Current viewport - the whole screen by default.
+ */
+static GRAPH_ViewportStruct view = {
+    0, 0,
+    {0, 0, ILI9320_WIDTH, ILI9320_HEIGHT},
+    {0, 0, ILI9320_WIDTH, ILI9320_HEIGHT}
+};
+static GRAPH_ViewportStruct viewStack[GRAPH_MAX_VIEWPORTS]; ///< Saved viewports
+static uint8_t viewDepth;                 ///< Number of saved viewports
+/**
+ * @brief Area which drawing functions may change (screen coordinates).
+ *
+ * @details Clip rectangle of the viewport limited to the band when
+ * drawing to a band buffer. All primitives are clipped to it before
+ * they touch the target.
+ */
+static GRAPH_RectStruct clip = {0, 0, ILI9320_WIDTH, ILI9320_HEIGHT};
+/**
+ * @brief Lines pinned by GRAPH_PinRegion() (width 0 - not pinned).
+ */
+static GRAPH_RectStruct pins[GRAPH_MAX_PINS];
+/**
+ * @brief Part of the screen not covered by pinned regions.
+ */
+static GRAPH_RectStruct unpinned = {0, 0, ILI9320_WIDTH, ILI9320_HEIGHT};
+
+static void GRAPH_PutPixel(int x, int y, uint16_t color);
+static void GRAPH_RunPixel(int x, int y, uint16_t color);
+static void GRAPH_RunFlush(void);
+static void GRAPH_FillRect(int x, int y, int w, int h, uint16_t color);
+static void GRAPH_BlitBegin(int x, int y, int w, int h);
+static void GRAPH_BlitBeginBottomUp(int x, int y, int w, int h);
+static void GRAPH_BlitPixels(const uint16_t* buf, uint32_t n);
+static void GRAPH_BlitPixelsAsync(const uint16_t* buf, uint32_t n);
+static void GRAPH_BlitFill(uint16_t color, uint32_t n);
+static void GRAPH_BlitEnd(void);
+static void GRAPH_BandWriteRow(int x, int y, const uint16_t* buf, int n);
+static uint16_t* GRAPH_BandPixel(int x, int y);
+static int GRAPH_Seam(int x0, int x1);
+static void GRAPH_MoveLines(int x, int n, int d);
+static void GRAPH_Intersect(GRAPH_RectStruct* r, const GRAPH_RectStruct* with);
+static void GRAPH_UpdateClip(void);
+static void GRAPH_UpdateUnpinned(void);
+static uint8_t GRAPH_IsInFont(uint8_t c);
+static void GRAPH_BlitGlyphs(const char* s, uint16_t n, int x, int y);
+static void GRAPH_FillRoundShape(int x, int y, int w, int h,
+    int rx, int ry, uint16_t color);
+static void GRAPH_DrawArcs(int cx, int cy, int radius, uint8_t octants,
+    uint16_t color);
+static void GRAPH_FillSegment(int ax, int ay, int bx, int by, int width,
+    uint16_t color);
+static void GRAPH_FillJoin(int cx, int cy, int width, uint16_t color);
+static int GRAPH_InitEdge(GRAPH_EdgeStruct* e, int32_t x0, int32_t y0,
+    int32_t x1, int32_t y1);
+static void GRAPH_StepEdge(GRAPH_EdgeStruct* e);
+static void GRAPH_SkipEdge(GRAPH_EdgeStruct* e, int rows);
+static void GRAPH_FillSpan(int32_t left, int32_t right, int row,
+    uint16_t color);
+static void GRAPH_FillPolygon(const int32_t* vx, const int32_t* vy, int n,
+    uint16_t color);
+static void GRAPH_FillTriangle(const int32_t* vx, const int32_t* vy,
+    uint16_t color);
+static void GRAPH_DecodeRle(const GRAPH_ImageStruct* img, int first,
+    int last, int left, int right);
+static void GRAPH_DecodeRlePiece(const GRAPH_ImageStruct* img, int first,
+    int last, int left, int right);
+static const void* GRAPH_ReadRlePacket(const GRAPH_ImageStruct* img,
+    const void* src, GRAPH_RlePacketStruct* packet);
+static void GRAPH_SendRlePixels(const GRAPH_ImageStruct* img,
+    const GRAPH_RlePacketStruct* packet, uint32_t offset, uint32_t n,
+    int* buf);
+static int GRAPH_IndexBits(GRAPH_ImageFormat format);
+static void GRAPH_BuildLut(const GRAPH_ImageStruct* img);
+static void GRAPH_ExpandIndices(const GRAPH_ImageStruct* img,
+    const uint8_t* src, int n, GRAPH_LineUnion* line);
+static void GRAPH_DrawIndexed(const GRAPH_ImageStruct* img, int px, int py,
+    int first, int last, int left, int right);
+static int GRAPH_ReadBmpHeader(int file, BMP_File* bmp, uint16_t* palette);
+static void GRAPH_JpegBlock(int x, int y, int w, int h,
+    const uint16_t* pixels);
+static int GRAPH_StreamBmp(int file, const BMP_File* bmp,
+    const uint16_t* palette, int px, int py);
+static uint32_t GRAPH_Get32(const uint8_t* p);
+static uint16_t GRAPH_Get16(const uint8_t* p);
+static uint32_t GRAPH_Sqrt(uint64_t v);
+static GRAPH_Color GRAPH_Dither(uint8_t r, uint8_t g, uint8_t b, int x, int y);
 
 
 /**
@@ -99,24 +321,295 @@ static GRAPH_ColorStruct currentBgColor;  ///< Global background color
  */
 void GRAPH_Init(void) {
   ILI9320_Initializtion();
+  viewDepth = 0;
+  memset(pins, 0, sizeof(pins));
+  unpinned = (GRAPH_RectStruct){0, 0, ILI9320_WIDTH, ILI9320_HEIGHT};
+  view = (GRAPH_ViewportStruct){
+    0, 0,
+    {0, 0, ILI9320_WIDTH, ILI9320_HEIGHT},
+    {0, 0, ILI9320_WIDTH, ILI9320_HEIGHT}
+  };
+  GRAPH_UpdateClip();
   // window occupies whole LCD screen
   ILI9320_SetWindow(0, 0, 320, 240);
   GRAPH_ClrScreen(0, 0, 0); // black screen on startup
 }
 /**
- * @brief Clears the screen with given color.
+ * @brief Selects an off-screen framebuffer as the target of drawing.
+ *
+ * @details All drawing functions change only the framebuffer
+ * (8 bpp, default RGB332 palette - see FB_SetPalette()) until
+ * GRAPH_Flush() is called, which sends the changed area to the LCD.
+ * The framebuffer is cleared to black.
+ *
+ * @param buf Framebuffer memory (FB_SIZE bytes) or null to draw
+ * directly on the LCD.
  */
-void GRAPH_ClrScreen(uint8_t r, uint8_t g, uint8_t b) {
+void GRAPH_SetFramebuffer(uint8_t* buf) {
+
+  if (buf) {
+    FB_Init(buf);
+    target = GRAPH_TARGET_FB;
+  } else {
+    target = GRAPH_TARGET_LCD;
+  }
+  GRAPH_UpdateClip();
+}
+/**
+ * @brief Selects a band buffer as the target of drawing.
+ *
+ * @details The band holds h full width rows starting at row y.
+ * All drawing functions render only the part of the scene which
+ * falls in the band, so a scene can be rendered band by band in
+ * little memory - see the STRIP module. Rows are stored in GRAM
+ * order (moved by the scroll amount of the LCD), so the band can be
+ * sent as a single full width window.
+ *
+ * The target selected before the band (LCD or framebuffer) is
+ * remembered and selected again when the band is released.
+ *
+ * @param buf Band memory (ILI9320_WIDTH * h pixels) or null to go
+ * back to the target used before the band.
+ * @param y Y coordinate of the first row of band
+ * @param h Number of rows in band
+ */
+void GRAPH_SetBand(uint16_t* buf, int y, int h) {
+
+  if (buf && target != GRAPH_TARGET_BAND) {
+    bandSaved = target;
+  }
+
+  band.buf = buf;
+  band.y = y;
+  band.h = h;
+  target = buf ? GRAPH_TARGET_BAND : bandSaved;
+  GRAPH_UpdateClip();
+}
+/**
+ * @brief Limits drawing to a rectangle of the current viewport.
+ *
+ * @details Coordinates are relative to the origin of the viewport
+ * and the rectangle is limited to the viewport.
+ *
+ * @param x X coordinate of clip rectangle
+ * @param y Y coordinate of clip rectangle
+ * @param w Width of clip rectangle
+ * @param h Height of clip rectangle
+ */
+void GRAPH_SetClip(int x, int y, int w, int h) {
+
+  view.clip.x0 = view.ox + x;
+  view.clip.y0 = view.oy + y;
+  view.clip.x1 = view.clip.x0 + w;
+  view.clip.y1 = view.clip.y0 + h;
+  GRAPH_Intersect(&view.clip, &view.bounds);
+  GRAPH_UpdateClip();
+}
+/**
+ * @brief Allows drawing in the whole current viewport.
+ */
+void GRAPH_ResetClip(void) {
+
+  view.clip = view.bounds;
+  GRAPH_UpdateClip();
+}
+/**
+ * @brief Saves the current viewport and opens a new one inside it.
+ *
+ * @details The origin of coordinates is moved to (x, y) and drawing
+ * is limited to the w x h area there (and to the clip rectangle
+ * of the previous viewport).
+ *
+ * @param x X coordinate of viewport (relative to current origin)
+ * @param y Y coordinate of viewport (relative to current origin)
+ * @param w Width of viewport
+ * @param h Height of viewport
+ * @retval 0 Viewport opened
+ * @retval -1 Too many viewports
+ */
+int GRAPH_PushViewport(int x, int y, int w, int h) {
+
+  if (viewDepth >= GRAPH_MAX_VIEWPORTS) {
+    return -1;
+  }
+
+  viewStack[viewDepth++] = view;
+
+  view.ox += x;
+  view.oy += y;
+  view.bounds.x0 = view.ox;
+  view.bounds.y0 = view.oy;
+  view.bounds.x1 = view.ox + w;
+  view.bounds.y1 = view.oy + h;
+  GRAPH_Intersect(&view.bounds, &viewStack[viewDepth - 1].clip);
+  view.clip = view.bounds;
+  GRAPH_UpdateClip();
+
+  return 0;
+}
+/**
+ * @brief Restores the viewport saved by GRAPH_PushViewport().
+ * @retval 0 Viewport restored
+ * @retval -1 No saved viewport
+ */
+int GRAPH_PopViewport(void) {
+
+  if (viewDepth == 0) {
+    return -1;
+  }
+
+  view = viewStack[--viewDepth];
+  GRAPH_UpdateClip();
+
+  return 0;
+}
+/**
+ * @brief Pins a band of lines at the left or right edge of the screen.
+ *
+ * @details Drawing functions never change the lines x to x + w - 1
+ * (full height) any more - the clip rectangle is limited to the rest
+ * of the screen, so clearing the screen, band renders and dirty redraws
+ * skip the pinned area - and GRAPH_Scroll() scrolls only the rest
+ * of the screen. Draw the static contents (header, footer) before
+ * pinning it.
+ *
+ * A pinned region has to touch the left or right edge, so the rest
+ * of the screen stays a rectangle.
+ *
+ * The partial images of the LCD are not used: the controller shows
+ * them only with the base image turned off, and two of them can not
+ * show the pinned lines together with a scrolled area, which wraps
+ * around in the GRAM. The pinned lines stay in the base image and
+ * are moved in the GRAM when it scrolls instead.
+ *
+ * @param n Region number (0 to GRAPH_MAX_PINS - 1)
+ * @param x X coordinate of first pinned line
+ * @param w Number of pinned lines
+ * @retval 0 Region pinned
+ * @retval -1 Wrong region or region overlaps another one
+ */
+int GRAPH_PinRegion(uint8_t n, int x, int w) {
+
+  if (n >= GRAPH_MAX_PINS || w <= 0 || x < 0 || x + w > ILI9320_WIDTH ||
+      (x != 0 && x + w != ILI9320_WIDTH)) {
+    return -1;
+  }
+
+  // pinned regions may not overlap
+  for (uint8_t i = 0; i < GRAPH_MAX_PINS; i++) {
+    if (i != n && pins[i].x1 > x && pins[i].x0 < x + w) {
+      return -1;
+    }
+  }
+
+  pins[n] = (GRAPH_RectStruct){x, 0, x + w, ILI9320_HEIGHT};
+  GRAPH_UpdateUnpinned();
+
+  return 0;
+}
+/**
+ * @brief Releases a region pinned by GRAPH_PinRegion().
+ *
+ * @details The lines keep their contents, can be drawn on
+ * and are scrolled with the rest of the screen again.
+ *
+ * @param n Region number (0 to GRAPH_MAX_PINS - 1)
+ */
+void GRAPH_UnpinRegion(uint8_t n) {
+
+  if (n >= GRAPH_MAX_PINS || pins[n].x1 == pins[n].x0) {
+    return;
+  }
+
+  pins[n] = (GRAPH_RectStruct){0, 0, 0, 0};
+  GRAPH_UpdateUnpinned();
+}
+/**
+ * @brief Returns the lines which are not pinned.
+ * @param x First line not pinned
+ * @param w Number of lines not pinned
+ */
+void GRAPH_GetUnpinned(int* x, int* w) {
 
-  GRAPH_ColorStruct tmp = currentColor; // save current color
+  *x = unpinned.x0;
+  *w = unpinned.x1 - unpinned.x0;
+}
+/**
+ * @brief Scrolls the screen along the X axis using hardware scrolling.
+ *
+ * @details The contents move left by the given number of lines (right
+ * if negative), which is a single register write. Drawing functions
+ * keep using logical coordinates - the lines exposed at the right
+ * edge (left edge if negative) are cleared with the background color
+ * and the caller draws only them.
+ *
+ * Only the lines which are not pinned scroll. The whole base image
+ * is scrolled, so the pinned lines are first moved in the GRAM by
+ * the same number of lines (see GRAPH_MoveLines()) - two bus cycles
+ * per pinned pixel on every scroll.
+ *
+ * @param lines Number of lines to scroll
+ * @retval 0 Screen scrolled
+ * @retval -1 The whole screen is pinned
+ */
+int GRAPH_Scroll(int lines) {
+
+  const GRAPH_RectStruct saved = clip;
+  const uint16_t bg = currentBgColor;
+  const int x0 = unpinned.x0;
+  const int x1 = unpinned.x1;
+
+  if (x1 == x0) {
+    return -1;
+  }
+
+  lines %= x1 - x0;
+
+  // the region moved first vacates the lines where the other one wraps
+  if (lines > 0) {
+    GRAPH_MoveLines(0, x0, lines);
+    GRAPH_MoveLines(x1, ILI9320_WIDTH - x1, lines);
+  } else if (lines < 0) {
+    GRAPH_MoveLines(x1, ILI9320_WIDTH - x1, lines);
+    GRAPH_MoveLines(0, x0, lines);
+  }
 
-  currentColor.r = r;
-  currentColor.b = b;
-  currentColor.g = g;
+  ILI9320_SetScroll((ILI9320_GetScroll() + ILI9320_WIDTH + lines)
+      % ILI9320_WIDTH);
+
+  // exposed lines are cleared whatever the viewport
+  clip = unpinned;
+  if (lines > 0) {
+    GRAPH_FillRect(x1 - lines, 0, lines, ILI9320_HEIGHT, bg);
+  } else if (lines < 0) {
+    GRAPH_FillRect(x0, 0, -lines, ILI9320_HEIGHT, bg);
+  }
+  clip = saved;
+
+  return 0;
+}
+/**
+ * @brief Sends everything drawn in the framebuffer since the last
+ * flush to the LCD.
+ */
+void GRAPH_Flush(void) {
 
-  GRAPH_DrawRectangle(0, 0, 320, 240);
+  if (target == GRAPH_TARGET_FB) {
+    FB_Flush();
+  }
+}
+/**
+ * @brief Clears the screen with given color.
+ *
+ * @details Only the clip rectangle is cleared. The screen is filled
+ * by DMA, so the function returns before the screen is cleared.
+ * Drawing functions wait for the transfer to finish before using
+ * the LCD.
+ */
+void GRAPH_ClrScreen(uint8_t r, uint8_t g, uint8_t b) {
 
-  currentColor = tmp;
+  GRAPH_FillRect(clip.x0, clip.y0, clip.x1 - clip.x0, clip.y1 - clip.y0,
+      GRAPH_RGB(r, g, b));
 }
 /**
  * @brief Sets the currently used font.
@@ -134,6 +627,7 @@ void GRAPH_SetFont(GRAPH_FontStruct font) {
  * @brief Sets the global color variable.
  *
  * @details All subsequent objects will be drawn using this color.
+ * The color is converted to the format of the LCD once, here.
  *
  * @param r Red
  * @param g Green
@@ -141,9 +635,15 @@ void GRAPH_SetFont(GRAPH_FontStruct font) {
  */
 void GRAPH_SetColor(uint8_t r, uint8_t g, uint8_t b) {
 
-  currentColor.r = r;
-  currentColor.b = b;
-  currentColor.g = g;
+  currentColor = GRAPH_RGB(r, g, b);
+}
+/**
+ * @brief Sets the global color variable to an already converted color.
+ * @param color Color (RGB565)
+ */
+void GRAPH_SetColor565(GRAPH_Color color) {
+
+  currentColor = color;
 }
 /**
  * @brief Sets the global background color variable.
@@ -154,78 +654,246 @@ void GRAPH_SetColor(uint8_t r, uint8_t g, uint8_t b) {
  */
 void GRAPH_SetBgColor(uint8_t r, uint8_t g, uint8_t b) {
 
-  currentBgColor.r = r;
-  currentBgColor.b = b;
-  currentBgColor.g = g;
+  currentBgColor = GRAPH_RGB(r, g, b);
 }
 /**
- * @brief Draws an image on screen.
- * @param x X coordinate of top right corner.
- * @param y Y coordinate of top right corner.
- *
- * TODO Make function more general.
+ * @brief Sets the global background color variable to an already
+ * converted color.
+ * @param color Color (RGB565)
  */
-void GRAPH_DrawImage(uint16_t x, uint16_t y) {
-
-  int r, g, b;
-  int pos;
+void GRAPH_SetBgColor565(GRAPH_Color color) {
 
-  for (int i = 0; i < displayedImage.rows; i++) { // rows
-    for (int j = 0; j < displayedImage.columns; j++) { // columns
-      pos = (i*displayedImage.columns+j)*displayedImage.bytesPerPixel;
-      r = displayedImage.data[pos];
-      g = displayedImage.data[pos+1];
-      b = displayedImage.data[pos+2];
-      ILI9320_DrawPixel(j+x, i+y, r, g, b);
-    }
-  }
+  currentBgColor = color;
+}
+/**
+ * @brief Turns ordered dithering of 24 bit images on or off.
+ *
+ * @details RGB888 images are converted to RGB565 by GRAPH_DrawImage().
+ * With dithering the lost low bits are spread as a 4x4 Bayer pattern
+ * (fixed to the screen, so neighbouring images match), which hides the
+ * banding of smooth gradients. It costs a table lookup per pixel.
+ * RGB565 images are drawn as they are - tools/imgconv -d dithers
+ * them when they are converted.
+ *
+ * @param enable 1 - dither images, 0 - truncate the components
+ */
+void GRAPH_SetDither(uint8_t enable) {
 
+  dither = enable;
 }
 /**
- * @brief Draws a character on screen.
- * @param c Character to draw (ASCII code)
- * @param x X coordinate of character
- * @param y T coordinate of character
+ * @brief Draws an image on screen.
+ *
+ * @details RGB565 images are sent to the LCD straight from their
+ * data (by DMA, also from flash) - an image which is not clipped
+ * on the sides is a single burst. RGB888 images are converted row
+ * by row, one row is sent while the next one is converted.
+ * RLE images are decoded into the same window - see GRAPH_DecodeRle(),
+ * indexed images are expanded row by row - see GRAPH_DrawIndexed().
+ *
+ * @param img Image to draw
+ * @param x X coordinate of top left corner.
+ * @param y Y coordinate of top left corner.
  */
-void GRAPH_DrawChar(uint8_t c, uint16_t x, uint16_t y) {
+void GRAPH_DrawImage(const GRAPH_ImageStruct* img, uint16_t x, uint16_t y) {
 
-  // no font set
-  if (currentFont.data == 0) {
+  const int px = x + view.ox;
+  const int py = y + view.oy;
+
+  // visible rows and columns of the image
+  const int first = (clip.y0 > py) ? clip.y0 - py : 0;
+  const int last = (clip.y1 - py < img->rows) ? clip.y1 - py : img->rows;
+  const int left = (clip.x0 > px) ? clip.x0 - px : 0;
+  const int right = (clip.x1 - px < img->columns) ?
+      clip.x1 - px : img->columns;
+
+  if (first >= last || left >= right) {
     return;
   }
 
-  const uint16_t row = c - currentFont.firstChar; // Font usually skips first chars (useless)
-  const uint16_t bitsPerByte = 8;
+  // a window can not cross the scroll seam of the LCD
+  const int seam = (target == GRAPH_TARGET_LCD) ?
+      GRAPH_Seam(px + left, px + right) : 0;
+  if (seam) {
+    const GRAPH_RectStruct saved = clip;
+    clip.x1 = seam;
+    GRAPH_DrawImage(img, x, y);
+    clip.x1 = saved.x1;
+    clip.x0 = seam;
+    GRAPH_DrawImage(img, x, y);
+    clip = saved;
+    return;
+  }
+
+  // when the LCD is synchronized to FMARK, the image is drawn
+  // in pieces right behind the scan line, so it is not torn
+  if (target == GRAPH_TARGET_LCD) {
+    if (right - left > ILI9320_VSYNC_LINES && ILI9320_GetScanLine() >= 0) {
+      const GRAPH_RectStruct saved = clip;
+      rleResume.img = img;
+      rleResume.next = -1;
+      for (int i = px + left; i < px + right; i += ILI9320_VSYNC_LINES) {
+        clip.x0 = i;
+        clip.x1 = (px + right - i < ILI9320_VSYNC_LINES) ?
+            px + right : i + ILI9320_VSYNC_LINES;
+        GRAPH_DrawImage(img, x, y);
+      }
+      rleResume.img = 0;
+      clip = saved;
+      return;
+    }
+    ILI9320_WaitScanOutside(px + left, right - left);
+  }
 
-  // if nonexisting char
-  if (row >= currentFont.numberOfChars) {
+  if (GRAPH_IndexBits(img->format)) {
+    GRAPH_DrawIndexed(img, px, py, first, last, left, right);
     return;
   }
 
-  const uint16_t pos = currentFont.columnCount *
-      currentFont.bytesPerColumn * row; // first byte of row
+  GRAPH_BlitBegin(px + left, py + first, right - left, last - first);
+
+  if (img->format == GRAPH_IMAGE_RLE565 || img->format == GRAPH_IMAGE_RLE8) {
+    if (img == rleResume.img) {
+      GRAPH_DecodeRlePiece(img, first, last, left, right);
+    } else {
+      GRAPH_DecodeRle(img, first, last, left, right);
+    }
+    GRAPH_BlitEnd();
+    return;
+  }
 
-  const uint8_t* ptr = currentFont.data;
+  if (img->format == GRAPH_IMAGE_RGB565) {
+    const uint16_t* src = (const uint16_t*)img->data +
+        first * img->columns + left;
+    if (right - left == img->columns) {
+      // whole rows follow each other in the data
+      GRAPH_BlitPixelsAsync(src, (last - first) * img->columns);
+    } else {
+      for (int i = first; i < last; i++) { // rows
+        GRAPH_BlitPixelsAsync(src, right - left);
+        src += img->columns;
+      }
+    }
+    GRAPH_BlitEnd();
+    return;
+  }
 
-  uint16_t bitmask;
+  // one converted row is sent by DMA while the next one is converted
+  uint16_t* buf;
+  const uint8_t* ptr;
+  const int stride = img->columns * 3;
 
-  for (int i = 0; i < currentFont.columnCount; i++) { // for 21 columns
-    for (int j = 0; j < currentFont.bytesPerColumn; j++) { // for 5 bytes per column
-      bitmask = 0x01; // start from lowest bit
-      for (int k = 0; k < bitsPerByte; k++, bitmask <<= 1) { // for 8 bits in byte
-        if (ptr[pos + i * currentFont.bytesPerColumn + j] & bitmask) {
-          ILI9320_DrawPixel(x+j*bitsPerByte+k, y+i,
-              currentColor.r, currentColor.g, currentColor.b);
-        } else {
-          ILI9320_DrawPixel(x+j*bitsPerByte+k, y+i,
-              currentBgColor.r, currentBgColor.g, currentBgColor.b);
-        }
+  for (int i = first; i < last; i++) { // rows
+    buf = lineBuf[i & 1].h;
+    ptr = (const uint8_t*)img->data + i * stride + left * 3;
+    if (dither) {
+      for (int j = 0; j < right - left; j++) { // columns
+        buf[j] = GRAPH_Dither(ptr[0], ptr[1], ptr[2], px + left + j, py + i);
+        ptr += 3;
+      }
+    } else {
+      for (int j = 0; j < right - left; j++) { // columns
+        buf[j] = GRAPH_RGB(ptr[0], ptr[1], ptr[2]);
+        ptr += 3;
       }
     }
+    // waits for the previous row to be sent
+    GRAPH_BlitPixelsAsync(buf, right - left);
+  }
+
+  GRAPH_BlitEnd(); // waits for the last row to be sent
+}
+/**
+ * @brief Draws a BMP file from the SD card.
+ *
+ * @details The file is streamed through a buffer of a single row,
+ * so images of any size can be shown without copying them to flash
+ * or RAM. Uncompressed 24 bit, 16 bit (X1R5G5B5 or R5G6B5 bit fields)
+ * and 8 bit (palette) files are supported. Rows are stored bottom-up
+ * in most files, so they are written to a window filled from the
+ * bottom and the file is read from start to end, without seeking
+ * back. Rows and columns outside the clip rectangle are not read.
+ *
+ * Reading the card takes longer than a frame, so the image is not
+ * synchronized to FMARK.
+ *
+ * @param name Name of file (8.3, as for FAT_OpenFile())
+ * @param x X coordinate of top left corner.
+ * @param y Y coordinate of top left corner.
+ * @retval 0 Image drawn
+ * @retval -1 File not found or read error
+ * @retval -2 Unsupported format
+ */
+int GRAPH_DrawBmpFile(const char* name, uint16_t x, uint16_t y) {
+
+  BMP_File bmp;
+  int ret;
+
+  const int file = FAT_OpenFile(name);
+  if (file < 0) {
+    return -1;
+  }
+
+  ret = GRAPH_ReadBmpHeader(file, &bmp, bmpPalette);
+  if (!ret) {
+    ret = GRAPH_StreamBmp(file, &bmp, bmpPalette, x + view.ox, y + view.oy);
+  }
+
+  FAT_CloseFile(file);
+  return ret;
+}
+/**
+ * @brief Draws a JPEG file from the SD card.
+ *
+ * @details The file is decoded MCU by MCU (see JPEG_Decode()) and
+ * every MCU is sent to its own window, while the next one is decoded.
+ * The whole file is decoded even if only a part of it is visible.
+ * As for BMP files, drawing is not synchronized to FMARK.
+ *
+ * @param name Name of file (8.3, as for FAT_OpenFile())
+ * @param x X coordinate of top left corner.
+ * @param y Y coordinate of top left corner.
+ * @param scale Image is scaled down 1, 2, 4 or 8 times
+ * @retval 0 Image drawn
+ * @retval -1 File not found or read error
+ * @retval -2 Unsupported format or scale
+ */
+int GRAPH_DrawJpegFile(const char* name, uint16_t x, uint16_t y,
+    uint8_t scale) {
+
+  const int file = FAT_OpenFile(name);
+  if (file < 0) {
+    return -1;
+  }
+
+  jpegX = x + view.ox;
+  jpegY = y + view.oy;
+  const int ret = JPEG_Decode(file, scale, GRAPH_JpegBlock);
+  GRAPH_BlitEnd(); // waits for the last block
+
+  FAT_CloseFile(file);
+  return ret;
+}
+/**
+ * @brief Draws a character on screen.
+ * @param c Character to draw (ASCII code)
+ * @param x X coordinate of character
+ * @param y T coordinate of character
+ */
+void GRAPH_DrawChar(uint8_t c, uint16_t x, uint16_t y) {
+
+  // no font set or nonexisting char
+  if (!GRAPH_IsInFont(c)) {
+    return;
   }
+
+  GRAPH_BlitGlyphs((const char*)&c, 1, x + view.ox, y + view.oy);
 }
 /**
  * @brief Writes a string on the LCD
+ *
+ * @details Consecutive characters are drawn in a single window.
+ *
  * @param s String to write
  * @param x X coordinate
  * @param y Y coordinate
@@ -233,11 +901,34 @@ void GRAPH_DrawChar(uint8_t c, uint16_t x, uint16_t y) {
  */
 void GRAPH_DrawString(const char* s, uint16_t x, uint16_t y) {
 
-  uint16_t len = strlen(s);
+  uint16_t n;
+  const int px = x + view.ox;
+  int py = y + view.oy;
+
+  if (currentFont.data == 0) {
+    return;
+  }
+
+  // characters below the clip rectangle are not visible
+  while (*s && py < clip.y1) {
+    // characters missing in font are skipped (the space is left as is)
+    if (!GRAPH_IsInFont(*s)) {
+      s++;
+      py += currentFont.columnCount;
+      continue;
+    }
+
+    // find how many next characters can be drawn in one window
+    n = 1;
+    while (s[n] && GRAPH_IsInFont(s[n])) {
+      n++;
+    }
+
+    GRAPH_BlitGlyphs(s, n, px, py);
 
-  // skip columnCount pixel columns for next char
-  for (int i = 0; i < len; i++, y+=currentFont.columnCount) {
-    GRAPH_DrawChar(s[i], x, y);
+    // skip columnCount pixel columns for next char
+    s += n;
+    py += n * currentFont.columnCount;
   }
 }
 /**
@@ -249,31 +940,118 @@ void GRAPH_DrawString(const char* s, uint16_t x, uint16_t y) {
  */
 void GRAPH_DrawRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
 
-  int i, j;
-  // Fill rectangle with color
-  for (i = x; i < x + w; i++) {
-    for (j = y; j < y + h; j++) {
-      ILI9320_DrawPixel(i, j, currentColor.r, currentColor.g, currentColor.b);
-    }
-  }
+  GRAPH_FillRect(x + view.ox, y + view.oy, w, h, currentColor);
 }
 /**
- * @brief Draws a box (empty rectangle).
+ * @brief Draws a filled rectangle with rounded corners.
  * @param x X coordinate of start point
  * @param y Y coordinate of start point
  * @param w Width
  * @param h Height
- * @param lineWidth Width of borders
+ * @param radius Radius of corners (limited to half of the shorter side)
  */
-void GRAPH_DrawBox(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t lineWidth) {
+void GRAPH_DrawRoundedRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+    uint16_t radius) {
 
-  // Draw borders
-  GRAPH_DrawRectangle(x, y, lineWidth, h);
-  GRAPH_DrawRectangle(x+lineWidth, y, w-2*lineWidth, lineWidth);
-  GRAPH_DrawRectangle(x+w-lineWidth, y, lineWidth, h);
-  GRAPH_DrawRectangle(x+lineWidth, y+h-lineWidth, w-2*lineWidth, lineWidth);
-}
-/**
+  if (w == 0 || h == 0) {
+    return;
+  }
+
+  if (radius > (w - 1) / 2) {
+    radius = (w - 1) / 2;
+  }
+  if (radius > (h - 1) / 2) {
+    radius = (h - 1) / 2;
+  }
+
+  GRAPH_FillRoundShape(x + view.ox, y + view.oy, w, h, radius, radius,
+      currentColor);
+}
+/**
+ * @brief Draws the outline of a rectangle with rounded corners.
+ *
+ * @details The edges are drawn with GRAPH_DrawHLine() and
+ * GRAPH_DrawVLine() and the corners as quarters of a circle, so the
+ * outline matches the edge of GRAPH_DrawRoundedRectangle().
+ *
+ * @param x X coordinate of start point
+ * @param y Y coordinate of start point
+ * @param w Width
+ * @param h Height
+ * @param radius Radius of corners (limited to half of the shorter side)
+ */
+void GRAPH_DrawRoundedBox(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+    uint16_t radius) {
+
+  if (w == 0 || h == 0) {
+    return;
+  }
+
+  if (radius > (w - 1) / 2) {
+    radius = (w - 1) / 2;
+  }
+  if (radius > (h - 1) / 2) {
+    radius = (h - 1) / 2;
+  }
+
+  const int x0 = x + view.ox + radius;         // left corner centers
+  const int x1 = x + view.ox + w - 1 - radius; // right corner centers
+  const int y0 = y + view.oy + radius;         // top corner centers
+  const int y1 = y + view.oy + h - 1 - radius; // bottom corner centers
+
+  GRAPH_DrawHLine(x + radius, y, w - 2 * radius);
+  GRAPH_DrawHLine(x + radius, y + h - 1, w - 2 * radius);
+  GRAPH_DrawVLine(x, y + radius, h - 2 * radius);
+  GRAPH_DrawVLine(x + w - 1, y + radius, h - 2 * radius);
+
+  if (radius) {
+    GRAPH_DrawArcs(x1, y1, radius, 0x03, currentColor);
+    GRAPH_DrawArcs(x0, y1, radius, 0x0c, currentColor);
+    GRAPH_DrawArcs(x0, y0, radius, 0x30, currentColor);
+    GRAPH_DrawArcs(x1, y0, radius, 0xc0, currentColor);
+  }
+}
+/**
+ * @brief Draws a box (empty rectangle).
+ *
+ * @details Borders one pixel wide are drawn as horizontal and
+ * vertical lines, wider ones as rectangles - every border is
+ * a single burst either way. A box whose borders meet inside
+ * is drawn as a filled rectangle.
+ *
+ * @param x X coordinate of start point
+ * @param y Y coordinate of start point
+ * @param w Width
+ * @param h Height
+ * @param lineWidth Width of borders
+ */
+void GRAPH_DrawBox(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t lineWidth) {
+
+  if (w == 0 || h == 0 || lineWidth == 0) {
+    return;
+  }
+
+  // no empty space inside - the lengths below would wrap around
+  if (w <= 2 * lineWidth || h <= 2 * lineWidth) {
+    GRAPH_DrawRectangle(x, y, w, h);
+    return;
+  }
+
+  if (lineWidth == 1) {
+    GRAPH_DrawVLine(x, y, h);
+    GRAPH_DrawHLine(x + 1, y, w - 2);
+    GRAPH_DrawVLine(x + w - 1, y, h);
+    GRAPH_DrawHLine(x + 1, y + h - 1, w - 2);
+    return;
+  }
+
+  // Draw borders
+  GRAPH_DrawRectangle(x, y, lineWidth, h);
+  GRAPH_DrawRectangle(x+lineWidth, y, w-2*lineWidth, lineWidth);
+  GRAPH_DrawRectangle(x+w-lineWidth, y, lineWidth, h);
+  GRAPH_DrawRectangle(x+lineWidth, y+h-lineWidth, w-2*lineWidth, lineWidth);
+}
+/**
  * @brief Draws a graph portraying data (measurements, etc.).
  * @param data Buffer for displayed data.
  * @param len Length of data vector.
@@ -300,26 +1078,41 @@ void GRAPH_DrawGraph(const uint8_t* data, uint16_t len, uint16_t x, uint16_t y)
   // X axis description
   GRAPH_DrawString("Voltage [V]", 5, 50);
   // X axis
-  GRAPH_DrawLine(x-2, y-2, x-2, 230);
+  GRAPH_DrawVLine(x-2, y-2, 230 - (y-2) + 1);
   GRAPH_DrawLine(x-2, 230, x-12, 220);
   GRAPH_DrawLine(x-2, 230, x+8, 220);
   // Y axis
-  GRAPH_DrawLine(x-2, y-2, 310, y-2);
+  GRAPH_DrawHLine(x-2, y-2, 310 - (x-2) + 1);
   GRAPH_DrawLine(310, y-2, 300, y-12);
   GRAPH_DrawLine(310, y-2, 300, y+8);
 
   if (len > maxDataLen)
     len = maxDataLen;
 
-  for (int i = 0; i < len; i++) {
+  const uint16_t color = currentColor;
+
+  const int px = x + view.ox;
+  const int py = y + view.oy;
+
+  // visible samples
+  const int first = (clip.x0 > px) ? clip.x0 - px : 0;
+  const int last = (clip.x1 - px < len) ? clip.x1 - px : len;
+
+  for (int i = first; i < last; i++) {
     // draw pixels up and down to make line more visible
-    ILI9320_DrawPixel(x+i,y+data[i]-1,
-        currentColor.r, currentColor.g, currentColor.b);
-    ILI9320_DrawPixel(x+i,y+data[i],
-        currentColor.r, currentColor.g, currentColor.b);
-    ILI9320_DrawPixel(x+i,y+data[i]+1,
-        currentColor.r, currentColor.g, currentColor.b);
+    int top = py + data[i] - 1;
+    int bottom = py + data[i] + 1;
+    if (top < clip.y0) {
+      top = clip.y0;
+    }
+    if (bottom >= clip.y1) {
+      bottom = clip.y1 - 1;
+    }
+    for (int j = top; j <= bottom; j++) {
+      GRAPH_RunPixel(px + i, j, color);
+    }
   }
+  GRAPH_RunFlush();
 
   GRAPH_SetFont(tmp); // restore font
 }
@@ -343,65 +1136,56 @@ void GRAPH_DrawBarChart(const uint8_t* data, uint16_t len,
 
   for (int i = 0; i < len; i++, pos+=width+space) {
     // draw pixels up and down to make line more visible
-    GRAPH_DrawRectangle(pos, 0, width, data[i]);
+    GRAPH_DrawRectangle(pos, y, width, data[i]);
   }
 }
 /**
  * @brief Draws a circle
- * @param x0 Center X coordinate.
- * @param y0 Center Y coordinate.
+ *
+ * @details The circle is drawn as eight octants, see GRAPH_DrawArcs().
+ *
+ * @param x Center X coordinate.
+ * @param y Center Y coordinate.
  * @param radius Circle radius.
  */
 void GRAPH_DrawCircle(uint16_t x, uint16_t y, uint16_t radius) {
 
-  int newX = radius;
-  int newY = 0;
-  int error = 1-newX;
-
-  while(newX >= newY) {
-    ILI9320_DrawPixel(newX + x, newY + y,
-        currentColor.r, currentColor.g, currentColor.b);
-    ILI9320_DrawPixel(newY + x, newX + y,
-        currentColor.r, currentColor.g, currentColor.b);
-    ILI9320_DrawPixel(-newX + x, newY + y,
-        currentColor.r, currentColor.g, currentColor.b);
-    ILI9320_DrawPixel(-newY + x, newX + y,
-        currentColor.r, currentColor.g, currentColor.b);
-    ILI9320_DrawPixel(-newX + x, -newY + y,
-        currentColor.r, currentColor.g, currentColor.b);
-    ILI9320_DrawPixel(-newY + x, -newX + y,
-        currentColor.r, currentColor.g, currentColor.b);
-    ILI9320_DrawPixel(newX + x, -newY + y,
-        currentColor.r, currentColor.g, currentColor.b);
-    ILI9320_DrawPixel(newY + x, -newX + y,
-        currentColor.r, currentColor.g, currentColor.b);
-
-    newY++;
-
-    if (error<0) {
-      error += 2 * newY + 1;
-    } else {
-      newX--;
-      error += 2 * (newY - newX + 1);
-    }
-  }
+  GRAPH_DrawArcs(x + view.ox, y + view.oy, radius, 0xff, currentColor);
 }
 /**
- * @brief Draws a fille circle
- * @param x0 Center X coordinate.
- * @param y0 Center Y coordinate.
+ * @brief Draws a filled circle
+ * @param x Center X coordinate.
+ * @param y Center Y coordinate.
  * @param radius Circle radius.
- * TODO Change implmentation - currenly not all pixels drawn
  */
 void GRAPH_DrawFilledCircle(uint16_t x, uint16_t y, uint16_t radius) {
 
-  while (radius--) {
-    GRAPH_DrawCircle(x,y,radius);
-  }
+  GRAPH_FillRoundShape(x + view.ox - radius, y + view.oy - radius,
+      2 * radius + 1, 2 * radius + 1,
+      radius, radius, currentColor);
+}
+/**
+ * @brief Draws a filled ellipse
+ * @param x Center X coordinate.
+ * @param y Center Y coordinate.
+ * @param rx Radius along the X axis.
+ * @param ry Radius along the Y axis.
+ */
+void GRAPH_DrawFilledEllipse(uint16_t x, uint16_t y, uint16_t rx, uint16_t ry) {
+
+  GRAPH_FillRoundShape(x + view.ox - rx, y + view.oy - ry,
+      2 * rx + 1, 2 * ry + 1, rx, ry, currentColor);
 }
 /**
  * @brief This function draws a line.
  *
+ * @details Bresenham's algorithm in closed form: the i-th pixel along
+ * the major axis (of length L) is moved k(i) = (i*m - L/2 + L - 1) / L
+ * pixels along the minor axis (of length m). The range of i in which
+ * both coordinates are inside the clip rectangle is calculated
+ * directly, so only visible pixels are drawn. Pixels on the same
+ * row (or column for steep lines) are drawn as a single burst.
+ *
  * @param x1 Starting point X coordinate
  * @param y1 Starting point Y coordinate
  * @param x2 End point X coordinate
@@ -409,43 +1193,1967 @@ void GRAPH_DrawFilledCircle(uint16_t x, uint16_t y, uint16_t radius) {
  */
 void GRAPH_DrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
 
-  int dx = x2>x1 ? (x2-x1) : (x1-x2); // slope
-  int sx = x1<x2 ? 1 : -1; // sign
-  int dy = y2>y1 ? (y2-y1) : (y1-y2); // slope
-  int sy = y1<y2 ? 1 : -1; // sign
+  const int ax = x1 + view.ox;
+  const int ay = y1 + view.oy;
+  const int bx = x2 + view.ox;
+  const int by = y2 + view.oy;
 
-  int err = (dx>dy ? dx : -dy)/2; // error
-  int tmpErr;
+  const int dx = bx>ax ? (bx-ax) : (ax-bx); // slope
+  const int sx = ax<bx ? 1 : -1; // sign
+  const int dy = by>ay ? (by-ay) : (ay-by); // slope
+  const int sy = ay<by ? 1 : -1; // sign
 
-  for(;;) {
+  // major and minor axis
+  const uint8_t xMajor = dx > dy;
+  const int len = xMajor ? dx : dy;   // length along major axis
+  const int minor = xMajor ? dy : dx; // length along minor axis
+  const int e0 = len/2;               // initial error
 
-    ILI9320_DrawPixel(x1, y1, currentColor.r, currentColor.g, currentColor.b);
+  int i0, i1;   // visible steps along major axis
+  int64_t a, b; // visible steps along minor axis
+  int64_t k;
+  int err;
 
-    // if end of line
-    if (x1==x2 && y1==y2) {
-      break;
+  const uint16_t color = currentColor;
+
+  // major axis
+  if (xMajor) {
+    i0 = (sx > 0) ? clip.x0 - ax : ax - (clip.x1 - 1);
+    i1 = (sx > 0) ? clip.x1 - 1 - ax : ax - clip.x0;
+    a = (sy > 0) ? clip.y0 - ay : ay - (clip.y1 - 1);
+    b = (sy > 0) ? clip.y1 - 1 - ay : ay - clip.y0;
+  } else {
+    i0 = (sy > 0) ? clip.y0 - ay : ay - (clip.y1 - 1);
+    i1 = (sy > 0) ? clip.y1 - 1 - ay : ay - clip.y0;
+    a = (sx > 0) ? clip.x0 - ax : ax - (clip.x1 - 1);
+    b = (sx > 0) ? clip.x1 - 1 - ax : ax - clip.x0;
+  }
+  if (i0 < 0) {
+    i0 = 0;
+  }
+  if (i1 > len) {
+    i1 = len;
+  }
+
+  // minor axis - k(i) is nondecreasing and goes from 0 to minor
+  if (b < 0 || a > minor) {
+    return;
+  }
+  if (minor > 0) {
+    if (a > 0) { // first i with k(i) >= a
+      k = ((a - 1) * len + e0 + 1 + minor - 1) / minor;
+      if (k > i0) {
+        i0 = k;
+      }
+    }
+    if (b < minor) { // last i with k(i) <= b
+      k = (b * len + e0) / minor;
+      if (k < i1) {
+        i1 = k;
+      }
+    }
+  }
+
+  if (i0 > i1) {
+    return;
+  }
+
+  // state of the algorithm at step i0
+  k = (len > 0) ? ((int64_t)i0 * minor - e0 + len - 1) / len : 0;
+  err = e0 - (int64_t)i0 * minor + k * len;
+
+  int x = ax + (xMajor ? sx * i0 : sx * (int)k);
+  int y = ay + (xMajor ? sy * (int)k : sy * i0);
+
+  for (int i = i0; i <= i1; i++) {
+
+    GRAPH_RunPixel(x, y, color);
+
+    if (xMajor) {
+      x += sx;
+    } else {
+      y += sy;
+    }
+
+    err -= minor;
+    if (err < 0) {
+      err += len;
+      if (xMajor) {
+        y += sy;
+      } else {
+        x += sx;
+      }
+    }
+  }
+
+  GRAPH_RunFlush();
+}
+
+/**
+ * @brief Draws a horizontal line (along the X axis).
+ *
+ * @details The line is a single burst - on the LCD just the cursor
+ * is set, without a window.
+ *
+ * @param x X coordinate of start point
+ * @param y Y coordinate of line
+ * @param len Length in pixels
+ */
+void GRAPH_DrawHLine(uint16_t x, uint16_t y, uint16_t len) {
+
+  GRAPH_FillRect(x + view.ox, y + view.oy, len, 1, currentColor);
+}
+/**
+ * @brief Draws a vertical line (along the Y axis).
+ *
+ * @details The line is a single burst in a window one pixel wide.
+ *
+ * @param x X coordinate of line
+ * @param y Y coordinate of start point
+ * @param len Length in pixels
+ */
+void GRAPH_DrawVLine(uint16_t x, uint16_t y, uint16_t len) {
+
+  GRAPH_FillRect(x + view.ox, y + view.oy, 1, len, currentColor);
+}
+/**
+ * @brief Draws a line of given width.
+ *
+ * @details The line is a rectangle around the segment between the
+ * centers of the end pixels, filled with horizontal spans. The ends
+ * are cut square at the end points.
+ *
+ * @param x1 Starting point X coordinate
+ * @param y1 Starting point Y coordinate
+ * @param x2 End point X coordinate
+ * @param y2 End point Y coordinate
+ * @param width Width of line (1 - same as GRAPH_DrawLine())
+ */
+void GRAPH_DrawThickLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+    uint8_t width) {
+
+  if (width <= 1) {
+    GRAPH_DrawLine(x1, y1, x2, y2);
+    return;
+  }
+
+  GRAPH_FillSegment(x1 + view.ox, y1 + view.oy, x2 + view.ox, y2 + view.oy,
+      width, currentColor);
+}
+/**
+ * @brief Draws connected line segments.
+ *
+ * @details Wide segments are drawn as with GRAPH_DrawThickLine() and
+ * joined with round joins (a disc as wide as the line at every inner
+ * point, filled with the same rounding), so there are no gaps at the
+ * corners and the joins do not stick out of the line.
+ *
+ * @param points Points to connect
+ * @param n Number of points
+ * @param width Width of line
+ */
+void GRAPH_DrawPolyline(const GRAPH_PointStruct* points, uint16_t n,
+    uint8_t width) {
+
+  for (int i = 1; i < n; i++) {
+    GRAPH_DrawThickLine(points[i - 1].x, points[i - 1].y,
+        points[i].x, points[i].y, width);
+  }
+
+  if (width <= 1) {
+    return;
+  }
+
+  for (int i = 1; i < n - 1; i++) {
+    GRAPH_FillJoin(points[i].x + view.ox, points[i].y + view.oy, width,
+        currentColor);
+  }
+}
+/**
+ * @brief Draws a filled triangle.
+ *
+ * @details The vertices are the centers of the given pixels and
+ * a pixel is filled if its center is inside the triangle, the left
+ * and top edges included. Triangles sharing an edge (for example
+ * the two halves of a gauge needle) meet without gaps and without
+ * drawing the common pixels twice.
+ *
+ * @param x1 X coordinate of first vertex
+ * @param y1 Y coordinate of first vertex
+ * @param x2 X coordinate of second vertex
+ * @param y2 Y coordinate of second vertex
+ * @param x3 X coordinate of third vertex
+ * @param y3 Y coordinate of third vertex
+ */
+void GRAPH_DrawFilledTriangle(uint16_t x1, uint16_t y1, uint16_t x2,
+    uint16_t y2, uint16_t x3, uint16_t y3) {
+
+  int32_t vx[3], vy[3];
+
+  vx[0] = ((int32_t)(x1 + view.ox) << 16) + 0x8000;
+  vy[0] = ((int32_t)(y1 + view.oy) << 16) + 0x8000;
+  vx[1] = ((int32_t)(x2 + view.ox) << 16) + 0x8000;
+  vy[1] = ((int32_t)(y2 + view.oy) << 16) + 0x8000;
+  vx[2] = ((int32_t)(x3 + view.ox) << 16) + 0x8000;
+  vy[2] = ((int32_t)(y3 + view.oy) << 16) + 0x8000;
+
+  GRAPH_FillTriangle(vx, vy, currentColor);
+}
+/**
+ * @brief Draws a filled polygon.
+ *
+ * @details The polygon may be concave or self-intersecting - areas
+ * circled by its outline are filled (non-zero winding rule). Pixels
+ * are filled as by GRAPH_DrawFilledTriangle(), so the right and
+ * bottom edges are not drawn. Triangles take a faster path.
+ *
+ * @param points Vertices
+ * @param n Number of vertices
+ * @retval 0 Polygon drawn
+ * @retval -1 More than GRAPH_MAX_EDGES vertices
+ */
+int GRAPH_DrawFilledPolygon(const GRAPH_PointStruct* points, uint16_t n) {
+
+  if (n > GRAPH_MAX_EDGES) {
+    return -1;
+  }
+
+  for (int i = 0; i < n; i++) {
+    polyX[i] = ((int32_t)(points[i].x + view.ox) << 16) + 0x8000;
+    polyY[i] = ((int32_t)(points[i].y + view.oy) << 16) + 0x8000;
+  }
+
+  if (n == 3) {
+    GRAPH_FillTriangle(polyX, polyY, currentColor);
+  } else if (n > 3) {
+    GRAPH_FillPolygon(polyX, polyY, n, currentColor);
+  }
+
+  return 0;
+}
+/**
+ * @brief Draws a pixel on the current target (LCD or framebuffer).
+ *
+ * @details The pixel has to be inside the clip rectangle.
+ *
+ * @param x X coordinate
+ * @param y Y coordinate
+ * @param color Color (RGB565)
+ */
+static void GRAPH_PutPixel(int x, int y, uint16_t color) {
+
+  switch (target) {
+  case GRAPH_TARGET_FB:
+    FB_PutPixel(x, y, FB_MatchColor(color));
+    break;
+  case GRAPH_TARGET_BAND:
+    if (x >= 0 && x < ILI9320_WIDTH && y >= band.y && y < band.y + band.h) {
+      *GRAPH_BandPixel(x, y) = color;
+    }
+    break;
+  default:
+    ILI9320_DrawPixelColor(x, y, color);
+    break;
+  }
+}
+/**
+ * @brief Draws a pixel as a part of a run.
+ *
+ * @details Consecutive pixels of the same color in a row or in
+ * a column (in any direction) are collected and drawn as a single
+ * burst by GRAPH_RunFlush(), instead of setting the cursor for every
+ * pixel. The pixel has to be inside the clip rectangle and
+ * GRAPH_RunFlush() has to be called after the last pixel.
+ *
+ * @param x X coordinate
+ * @param y Y coordinate
+ * @param color Color (RGB565)
+ */
+static void GRAPH_RunPixel(int x, int y, uint16_t color) {
+
+  if (run.n && color == run.color) {
+    if (y == run.y && (run.n == 1 || !run.vertical) &&
+        (x == run.x + run.n || x == run.x - 1)) {
+      run.vertical = 0;
+      run.x = (x < run.x) ? x : run.x;
+      run.n++;
+      return;
+    }
+    if (x == run.x && (run.n == 1 || run.vertical) &&
+        (y == run.y + run.n || y == run.y - 1)) {
+      run.vertical = 1;
+      run.y = (y < run.y) ? y : run.y;
+      run.n++;
+      return;
+    }
+  }
+
+  GRAPH_RunFlush();
+  run.x = x;
+  run.y = y;
+  run.n = 1;
+  run.color = color;
+}
+/**
+ * @brief Draws the pixels collected by GRAPH_RunPixel().
+ *
+ * @details A run costs the setting of a window, so short runs are
+ * drawn pixel by pixel.
+ */
+static void GRAPH_RunFlush(void) {
+
+  if (run.n >= GRAPH_MIN_RUN) {
+    GRAPH_FillRect(run.x, run.y, run.vertical ? 1 : run.n,
+        run.vertical ? run.n : 1, run.color);
+  } else {
+    for (int i = 0; i < run.n; i++) {
+      GRAPH_PutPixel(run.vertical ? run.x : run.x + i,
+          run.vertical ? run.y + i : run.y, run.color);
     }
+  }
+  run.n = 0;
+}
+/**
+ * @brief Fills a rectangle with a color in one burst.
+ * @param x X coordinate of start point
+ * @param y Y coordinate of start point
+ * @param w Width
+ * @param h Height
+ * @param color Color (RGB565)
+ */
+static void GRAPH_FillRect(int x, int y, int w, int h, uint16_t color) {
+
+  // clip
+  if (x < clip.x0) {
+    w -= clip.x0 - x;
+    x = clip.x0;
+  }
+  if (x + w > clip.x1) {
+    w = clip.x1 - x;
+  }
+  if (y < clip.y0) {
+    h -= clip.y0 - y;
+    y = clip.y0;
+  }
+  if (y + h > clip.y1) {
+    h = clip.y1 - y;
+  }
+
+  if (w <= 0 || h <= 0) {
+    return;
+  }
+
+  if (target == GRAPH_TARGET_FB) {
+    FB_FillRect(x, y, w, h, FB_MatchColor(color));
+    return;
+  }
 
-    tmpErr = err;
+  // split at the scroll seam - the two parts are apart in GRAM
+  const int seam = GRAPH_Seam(x, x + w);
+  if (seam) {
+    GRAPH_FillRect(x, y, seam - x, h, color);
+    GRAPH_FillRect(seam, y, x + w - seam, h, color);
+    return;
+  }
 
-    if (tmpErr >-dx) {
-      err -= dy;
-      x1 += sx;
+  if (target == GRAPH_TARGET_BAND) {
+    for (int i = 0; i < h; i++) {
+      uint16_t* dst = GRAPH_BandPixel(x, y + i);
+      for (int j = 0; j < w; j++) {
+        dst[j] = color;
+      }
     }
+    return;
+  }
+
+  const uint32_t n = (uint32_t)w * h;
+
+  ILI9320_WriteBegin(x, y, w, h);
+  if (n >= GRAPH_DMA_FILL_MIN) {
+    // returns immediately, next access to LCD waits for the end of transfer
+    ILI9320_WriteFillAsync(color, n, 0);
+  } else {
+    ILI9320_WriteFill(color, n);
+  }
+  ILI9320_WriteEnd();
+}
+/**
+ * @brief Opens a window on the current target.
+ *
+ * @details Pixels are then written with GRAPH_BlitPixels() row by row -
+ * X increments first, then Y.
+ *
+ * @param x X coordinate of start point
+ * @param y Y coordinate of start point
+ * @param w Width
+ * @param h Height
+ */
+static void GRAPH_BlitBegin(int x, int y, int w, int h) {
+
+  blit.x = x;
+  blit.y = y;
+  blit.w = w;
+  blit.col = 0;
+  blit.row = 0;
+  blit.step = 1;
+
+  if (target == GRAPH_TARGET_LCD) {
+    ILI9320_WriteBegin(x, y, w, h);
+  }
+}
+/**
+ * @brief Opens a window on the current target, filled from the bottom.
+ *
+ * @details Same as GRAPH_BlitBegin(), but the rows are written
+ * starting with the bottom one (each row from left to right).
+ *
+ * @param x X coordinate of start point
+ * @param y Y coordinate of start point
+ * @param w Width
+ * @param h Height
+ */
+static void GRAPH_BlitBeginBottomUp(int x, int y, int w, int h) {
+
+  blit.x = x;
+  blit.y = y;
+  blit.w = w;
+  blit.col = 0;
+  blit.row = h - 1;
+  blit.step = -1;
+
+  if (target == GRAPH_TARGET_LCD) {
+    ILI9320_WriteBeginBottomUp(x, y, w, h);
+  }
+}
+/**
+ * @brief Writes pixels to the opened window.
+ * @param buf Pixels (RGB565)
+ * @param n Number of pixels
+ */
+static void GRAPH_BlitPixels(const uint16_t* buf, uint32_t n) {
 
-    if (tmpErr < dy) {
-      err += dx;
-      y1 += sy;
+  uint32_t count;
+
+  if (target == GRAPH_TARGET_LCD) {
+    ILI9320_WritePixels(buf, n);
+    return;
+  }
+
+  while (n) {
+    count = blit.w - blit.col; // pixels left in current row
+    if (count > n) {
+      count = n;
     }
+    if (target == GRAPH_TARGET_FB) {
+      FB_WriteRow(blit.x + blit.col, blit.y + blit.row, buf, count);
+    } else {
+      GRAPH_BandWriteRow(blit.x + blit.col, blit.y + blit.row, buf, count);
+    }
+    buf += count;
+    n -= count;
+    blit.col += count;
+    if (blit.col == blit.w) {
+      blit.col = 0;
+      blit.row += blit.step;
+    }
+  }
+}
+/**
+ * @brief Writes pixels to the opened window without waiting for the end.
+ *
+ * @details The LCD is written by DMA - the buffer has to stay unchanged
+ * until the next call or GRAPH_BlitEnd().
+ *
+ * @param buf Pixels (RGB565)
+ * @param n Number of pixels
+ */
+static void GRAPH_BlitPixelsAsync(const uint16_t* buf, uint32_t n) {
+
+  if (target == GRAPH_TARGET_LCD) {
+    ILI9320_WritePixelsAsync(buf, n, 0);
+    return;
   }
-//  double x, y, dx, dy;
-//  dx = x2 - x1; // Change in X
-//  dy = y2 - y1; // Change in Y
-//
-//  for (x = x1; x < x2; x++) {
-//    y = y1 + dy * (x - x1) / dx;
-//    ILI9320_DrawPixel(x, y, currentColor.r, currentColor.g, currentColor.b);
-//  }
+
+  GRAPH_BlitPixels(buf, n);
+}
+/**
+ * @brief Writes pixels of one color to the opened window.
+ *
+ * @details The LCD is filled by DMA without waiting for the end,
+ * as in GRAPH_BlitPixelsAsync().
+ *
+ * @param color Color (RGB565)
+ * @param n Number of pixels
+ */
+static void GRAPH_BlitFill(uint16_t color, uint32_t n) {
+
+  uint32_t count;
+
+  if (target == GRAPH_TARGET_LCD) {
+    ILI9320_WriteFillAsync(color, n, 0);
+    return;
+  }
+
+  while (n) {
+    count = blit.w - blit.col; // pixels left in current row
+    if (count > n) {
+      count = n;
+    }
+    GRAPH_FillRect(blit.x + blit.col, blit.y + blit.row, count, 1, color);
+    n -= count;
+    blit.col += count;
+    if (blit.col == blit.w) {
+      blit.col = 0;
+      blit.row += blit.step;
+    }
+  }
+}
+/**
+ * @brief Closes the window opened by GRAPH_BlitBegin().
+ *
+ * @details Waits until all pixels are written, so the buffers
+ * used by the caller can be released.
+ */
+static void GRAPH_BlitEnd(void) {
+
+  if (target == GRAPH_TARGET_LCD) {
+    ILI9320_WaitTransfer();
+    ILI9320_WriteEnd();
+  }
+}
+/**
+ * @brief Copies a part of a row to the band buffer.
+ * @param x X coordinate of first pixel
+ * @param y Y coordinate of row
+ * @param buf Pixels (RGB565)
+ * @param n Number of pixels
+ */
+static void GRAPH_BandWriteRow(int x, int y, const uint16_t* buf, int n) {
+
+  if (y < band.y || y >= band.y + band.h) {
+    return;
+  }
+  if (x < 0) {
+    buf -= x;
+    n += x;
+    x = 0;
+  }
+  if (x + n > ILI9320_WIDTH) {
+    n = ILI9320_WIDTH - x;
+  }
+  if (n <= 0) {
+    return;
+  }
+
+  // split at the scroll seam - the two parts are apart in the band
+  const int seam = GRAPH_Seam(x, x + n);
+  if (seam) {
+    GRAPH_BandWriteRow(x, y, buf, seam - x);
+    GRAPH_BandWriteRow(seam, y, buf + seam - x, x + n - seam);
+    return;
+  }
+
+  memcpy(GRAPH_BandPixel(x, y), buf, n * sizeof(uint16_t));
+}
+/**
+ * @brief Returns the address of a pixel in the band buffer.
+ * @param x X coordinate (logical)
+ * @param y Y coordinate (inside band)
+ * @return Pointer to pixel
+ */
+static uint16_t* GRAPH_BandPixel(int x, int y) {
+
+  x += ILI9320_GetScroll();
+  if (x >= ILI9320_WIDTH) {
+    x -= ILI9320_WIDTH;
+  }
+  return band.buf + (y - band.y) * ILI9320_WIDTH + x;
+}
+/**
+ * @brief Finds the scroll seam inside a range of X coordinates.
+ *
+ * @details With hardware scrolling the lines from the seam on are
+ * placed at the beginning of the GRAM (and of a band buffer), so
+ * a window crossing the seam has to be split. The framebuffer is
+ * not scrolled.
+ *
+ * @param x0 First X coordinate
+ * @param x1 Last X coordinate + 1
+ * @return X coordinate of seam or 0 if the range does not cross it.
+ */
+static int GRAPH_Seam(int x0, int x1) {
+
+  int seam;
+
+  if (target == GRAPH_TARGET_FB) {
+    return 0;
+  }
+
+  seam = ILI9320_GetScrollSeam();
+  return (x0 < seam && seam < x1) ? seam : 0;
+}
+/**
+ * @brief Moves lines of the LCD along the X axis.
+ *
+ * @details Every line is read back from the GRAM and written d lines
+ * further, wrapped around the screen. The line nearest to the new
+ * place is moved first, so the lines may overlap their new place.
+ *
+ * @param x First line
+ * @param n Number of lines
+ * @param d Distance (negative - to the left)
+ */
+static void GRAPH_MoveLines(int x, int n, int d) {
+
+  uint16_t* const buf = lineBuf[0].h;
+
+  for (int i = 0; i < n; i++) {
+    const int from = (d > 0) ? x + n - 1 - i : x + i;
+    const int to = (from + d + ILI9320_WIDTH) % ILI9320_WIDTH;
+    ILI9320_ReadPixels(from, 0, 1, ILI9320_HEIGHT, buf);
+    ILI9320_WriteBegin(to, 0, 1, ILI9320_HEIGHT);
+    ILI9320_WritePixels(buf, ILI9320_HEIGHT);
+    ILI9320_WriteEnd();
+  }
+}
+/**
+ * @brief Limits a rectangle to another one.
+ * @param r Rectangle to limit
+ * @param with Limiting rectangle
+ */
+static void GRAPH_Intersect(GRAPH_RectStruct* r, const GRAPH_RectStruct* with) {
+
+  if (r->x0 < with->x0) {
+    r->x0 = with->x0;
+  }
+  if (r->y0 < with->y0) {
+    r->y0 = with->y0;
+  }
+  if (r->x1 > with->x1) {
+    r->x1 = with->x1;
+  }
+  if (r->y1 > with->y1) {
+    r->y1 = with->y1;
+  }
+}
+/**
+ * @brief Calculates the area which drawing functions may change.
+ */
+static void GRAPH_UpdateClip(void) {
+
+  clip = view.clip;
+  GRAPH_Intersect(&clip, &unpinned);
+
+  if (target == GRAPH_TARGET_BAND) {
+    const GRAPH_RectStruct rows = {0, band.y, ILI9320_WIDTH, band.y + band.h};
+    GRAPH_Intersect(&clip, &rows);
+  }
+}
+/**
+ * @brief Recalculates the area left by pinned regions.
+ */
+static void GRAPH_UpdateUnpinned(void) {
+
+  unpinned = (GRAPH_RectStruct){0, 0, ILI9320_WIDTH, ILI9320_HEIGHT};
+
+  for (uint8_t i = 0; i < GRAPH_MAX_PINS; i++) {
+    if (pins[i].x1 == pins[i].x0) {
+      continue;
+    }
+    if (pins[i].x0 == 0) {
+      if (pins[i].x1 > unpinned.x0) {
+        unpinned.x0 = pins[i].x1;
+      }
+    } else if (pins[i].x0 < unpinned.x1) {
+      unpinned.x1 = pins[i].x0;
+    }
+  }
+  GRAPH_UpdateClip();
+}
+/**
+ * @brief Checks if a character can be drawn with the current font.
+ * @param c Character (ASCII code)
+ * @retval 1 Character exists in font
+ * @retval 0 No font set or nonexisting char
+ */
+static uint8_t GRAPH_IsInFont(uint8_t c) {
+
+  if (currentFont.data == 0) {
+    return 0;
+  }
+
+  // Font usually skips first chars (useless)
+  return (uint8_t)(c - currentFont.firstChar) < currentFont.numberOfChars;
+}
+/**
+ * @brief Draws n characters of the current font in one window.
+ *
+ * @details Font columns are rows of the window (characters of a string
+ * are placed one after another along the Y axis) and the first pixel of
+ * a column is the LSB of its first byte. This is the order in which the
+ * LCD fills a window (X increments first, then Y), so every column is
+ * expanded to foreground/background colors and streamed as it is.
+ * Characters are taken from the glyph cache if possible, where they
+ * are already expanded, so the whole character is a single burst.
+ *
+ * The window is clipped to the clip rectangle - characters outside
+ * it are skipped and only the visible part of every row is sent.
+ *
+ * @param s Characters to draw (all have to exist in the font)
+ * @param n Number of characters
+ * @param x X coordinate of first character (on screen)
+ * @param y Y coordinate of first character (on screen)
+ */
+static void GRAPH_BlitGlyphs(const char* s, uint16_t n, int x, int y) {
+
+  const uint16_t bitsPerByte = 8;
+  const int width = currentFont.bytesPerColumn * bitsPerByte;
+  const int rows = currentFont.columnCount;
+  const uint16_t fg = currentColor;
+  const uint16_t bg = currentBgColor;
+
+  uint16_t line[GRAPH_MAX_GLYPH_WIDTH];
+  const uint8_t* ptr;
+  const uint16_t* cached;
+  uint16_t* out;
+  uint8_t bits;
+
+  if (width > GRAPH_MAX_GLYPH_WIDTH) {
+    return;
+  }
+
+  // visible part of window
+  const int x0 = (x > clip.x0) ? x : clip.x0;
+  const int x1 = (x + width < clip.x1) ? x + width : clip.x1;
+  const int y0 = (y > clip.y0) ? y : clip.y0;
+  const int y1 = (y + n * rows < clip.y1) ? y + n * rows : clip.y1;
+
+  if (x0 >= x1 || y0 >= y1) {
+    return;
+  }
+
+  // a window can not cross the scroll seam of the LCD
+  const int seam = (target == GRAPH_TARGET_LCD) ? GRAPH_Seam(x0, x1) : 0;
+  if (seam) {
+    const GRAPH_RectStruct saved = clip;
+    clip.x1 = seam;
+    GRAPH_BlitGlyphs(s, n, x, y);
+    clip.x1 = saved.x1;
+    clip.x0 = seam;
+    GRAPH_BlitGlyphs(s, n, x, y);
+    clip = saved;
+    return;
+  }
+
+  const int left = x0 - x; // first visible pixel of a row
+  const int w = x1 - x0;   // visible pixels of a row
+
+  GRAPH_BlitBegin(x0, y0, w, y1 - y0);
+
+  // only characters which are at least partly visible
+  for (int c = (y0 - y) / rows; c <= (y1 - 1 - y) / rows; c++) {
+
+    const int charY = y + c * rows;
+    const int first = (y0 > charY) ? y0 - charY : 0;
+    const int last = (y1 < charY + rows) ? y1 - charY : rows;
+
+    cached = GLYPH_CacheGet(&currentFont, s[c], fg, bg);
+    if (cached) {
+      if (w == width) { // visible rows are one block
+        GRAPH_BlitPixels(cached + first * width, (last - first) * width);
+      } else {
+        for (int i = first; i < last; i++) {
+          GRAPH_BlitPixels(cached + i * width + left, w);
+        }
+      }
+      continue;
+    }
+
+    // first visible column of char
+    ptr = currentFont.data + currentFont.bytesPerColumn *
+        (rows * (uint8_t)(s[c] - currentFont.firstChar) + first);
+
+    for (int i = first; i < last; i++) { // for every column
+      out = line;
+      for (int j = 0; j < currentFont.bytesPerColumn; j++) { // for every byte in column
+        bits = *ptr++;
+        for (int k = 0; k < bitsPerByte; k++, bits >>= 1) { // start from lowest bit
+          *out++ = (bits & 0x01) ? fg : bg;
+        }
+      }
+      GRAPH_BlitPixels(line + left, w);
+    }
+  }
+
+  GRAPH_BlitEnd();
+}
+/**
+ * @brief Draws octants of a circle.
+ *
+ * @details Octant i is drawn if bit i of octants is set. Octants 0-1
+ * are the quarter with growing X and Y, 2-3 with falling X, 4-5 with
+ * falling X and Y and 6-7 with falling Y (Y grows down the screen).
+ *
+ * Every octant is clipped as a whole - it is skipped if its bounding
+ * box is outside the clip rectangle, and drawn without checking its
+ * pixels if the box is inside. Only octants crossing an edge are
+ * clipped pixel by pixel. Steep parts of an octant are vertical runs
+ * of pixels and flat parts horizontal ones - each run is a single burst.
+ *
+ * @param cx Center X coordinate (on screen)
+ * @param cy Center Y coordinate (on screen)
+ * @param radius Radius
+ * @param octants Octants to draw (bit mask)
+ * @param color Color (RGB565)
+ */
+static void GRAPH_DrawArcs(int cx, int cy, int radius, uint8_t octants,
+    uint16_t color) {
+
+  // signs of octant coordinates and swapping of newX and newY
+  static const int8_t signX[8] = { 1,  1, -1, -1, -1, -1,  1,  1};
+  static const int8_t signY[8] = { 1,  1,  1,  1, -1, -1, -1, -1};
+  static const uint8_t swap[8] = { 0,  1,  0,  1,  0,  1,  0,  1};
+
+  enum { SKIP, DRAW, CHECK };
+  uint8_t mode[8];
+  uint8_t visible = 0;
+
+  int newX;
+  int newY;
+  int error;
+
+  // newX stays between about r/sqrt(2) and r and newY between 0 and
+  // r/sqrt(2), with some margin (181/256 = 0.707)
+  int lo = ((radius * 181) >> 8) - 2;
+  int hi = ((radius * 181) >> 8) + 2;
+  if (lo < 0) {
+    lo = 0;
+  }
+  if (hi > radius) {
+    hi = radius;
+  }
+
+  for (int i = 0; i < 8; i++) {
+    if (!(octants & (1 << i))) {
+      mode[i] = SKIP;
+      continue;
+    }
+    const int aMin = swap[i] ? 0 : lo;
+    const int aMax = swap[i] ? hi : radius;
+    const int bMin = swap[i] ? lo : 0;
+    const int bMax = swap[i] ? radius : hi;
+    const int x0 = cx + (signX[i] > 0 ? aMin : -aMax);
+    const int x1 = cx + (signX[i] > 0 ? aMax : -aMin);
+    const int y0 = cy + (signY[i] > 0 ? bMin : -bMax);
+    const int y1 = cy + (signY[i] > 0 ? bMax : -bMin);
+
+    if (x1 < clip.x0 || x0 >= clip.x1 || y1 < clip.y0 || y0 >= clip.y1) {
+      mode[i] = SKIP;
+    } else if (x0 >= clip.x0 && x1 < clip.x1 &&
+        y0 >= clip.y0 && y1 < clip.y1) {
+      mode[i] = DRAW;
+      visible = 1;
+    } else {
+      mode[i] = CHECK;
+      visible = 1;
+    }
+  }
+
+  if (!visible) {
+    return;
+  }
+
+  // octants are drawn one by one, so their pixels form runs
+  for (int i = 0; i < 8; i++) {
+    if (mode[i] == SKIP) {
+      continue;
+    }
+
+    newX = radius;
+    newY = 0;
+    error = 1-newX;
+
+    while(newX >= newY) {
+      const int px = cx + signX[i] * (swap[i] ? newY : newX);
+      const int py = cy + signY[i] * (swap[i] ? newX : newY);
+      if (mode[i] == DRAW || (px >= clip.x0 && px < clip.x1 &&
+          py >= clip.y0 && py < clip.y1)) {
+        GRAPH_RunPixel(px, py, color);
+      }
+
+      newY++;
+
+      if (error<0) {
+        error += 2 * newY + 1;
+      } else {
+        newX--;
+        error += 2 * (newY - newX + 1);
+      }
+    }
+  }
+
+  GRAPH_RunFlush();
+}
+/**
+ * @brief Fills a shape with elliptical corners using horizontal spans.
+ *
+ * @details The shape is a w x h rectangle, whose corners are quarters
+ * of an ellipse with radii rx and ry. A circle is a shape with
+ * w = h = 2r+1 and rx = ry = r. Every row of the shape is drawn once
+ * as a single span, and the straight middle part as one rectangle.
+ *
+ * The half width of a corner row is found in the same way as in
+ * the midpoint algorithm - the point (dx, dy) is inside the ellipse if
+ * ry^2*dx^2 + rx^2*dy^2 <= rx^2*ry^2 + rx*ry*min(rx,ry),
+ * which for a circle is dx^2 + dy^2 <= r^2 + r. Since the half width
+ * only gets smaller when moving away from the center, all rows
+ * are found in O(rx + ry) steps.
+ *
+ * @param x X coordinate of start point
+ * @param y Y coordinate of start point
+ * @param w Width (at least 2*rx+1)
+ * @param h Height (at least 2*ry+1)
+ * @param rx Radius of corners along X
+ * @param ry Radius of corners along Y
+ * @param color Color (RGB565)
+ */
+static void GRAPH_FillRoundShape(int x, int y, int w, int h,
+    int rx, int ry, uint16_t color) {
+
+  const int64_t rx2 = (int64_t)rx * rx;
+  const int64_t ry2 = (int64_t)ry * ry;
+  const int64_t limit = rx2 * ry2 + (int64_t)rx * ry * (rx < ry ? rx : ry);
+
+  const int innerW = w - 2 * rx; // width of straight part of top and bottom edge
+  const int top = y + ry;        // row of corner centers at the top
+  const int bottom = y + h - 1 - ry; // row of corner centers at the bottom
+
+  int hw = rx; // half width of current corner row
+
+  for (int dy = 1; dy <= ry; dy++) {
+    while (hw > 0 && ry2 * hw * hw + rx2 * dy * dy > limit) {
+      hw--;
+    }
+    GRAPH_FillRect(x + rx - hw, top - dy, innerW + 2 * hw, 1, color);
+    GRAPH_FillRect(x + rx - hw, bottom + dy, innerW + 2 * hw, 1, color);
+  }
+
+  // middle part (including rows of corner centers)
+  GRAPH_FillRect(x, top, w, bottom - top + 1, color);
+}
+/**
+ * @brief Fills a rectangle of given width around a segment.
+ *
+ * @details The corners are calculated in 16.16 fixed point around
+ * the centers of the end pixels - the end points moved by half of the
+ * width perpendicular to the segment.
+ *
+ * @param ax X coordinate of start point (on screen)
+ * @param ay Y coordinate of start point (on screen)
+ * @param bx X coordinate of end point (on screen)
+ * @param by Y coordinate of end point (on screen)
+ * @param width Width
+ * @param color Color (RGB565)
+ */
+static void GRAPH_FillSegment(int ax, int ay, int bx, int by, int width,
+    uint16_t color) {
+
+  const int dx = bx - ax;
+  const int dy = by - ay;
+  int32_t vx[4], vy[4];
+  int32_t ox, oy;
+
+  if (dx == 0 && dy == 0) {
+    GRAPH_FillRect(ax - width / 2, ay - width / 2, width, width, color);
+    return;
+  }
+
+  // offset (width/2 * normal) in 16.16 from the length in 8.8
+  const uint32_t len = GRAPH_Sqrt(((uint64_t)dx * dx + (uint64_t)dy * dy) << 16);
+  ox = (int32_t)(((int64_t)-dy * width << 23) / len);
+  oy = (int32_t)(((int64_t)dx * width << 23) / len);
+
+  // centers of the end pixels
+  const int32_t cax = ((int32_t)ax << 16) + 0x8000;
+  const int32_t cay = ((int32_t)ay << 16) + 0x8000;
+  const int32_t cbx = ((int32_t)bx << 16) + 0x8000;
+  const int32_t cby = ((int32_t)by << 16) + 0x8000;
+
+  vx[0] = cax + ox; vy[0] = cay + oy;
+  vx[1] = cbx + ox; vy[1] = cby + oy;
+  vx[2] = cbx - ox; vy[2] = cby - oy;
+  vx[3] = cax - ox; vy[3] = cay - oy;
+
+  GRAPH_FillPolygon(vx, vy, 4, color);
+}
+/**
+ * @brief Fills a disc around the center of a pixel.
+ *
+ * @details The diameter is the width of a line drawn by
+ * GRAPH_FillSegment() and pixels are filled with the same rule
+ * (centers inside, the left and top edges included), so a disc
+ * at the end of a segment is exactly as wide as the segment.
+ *
+ * @param cx X coordinate of center pixel (on screen)
+ * @param cy Y coordinate of center pixel (on screen)
+ * @param width Diameter
+ * @param color Color (RGB565)
+ */
+static void GRAPH_FillJoin(int cx, int cy, int width, uint16_t color) {
+
+  const int64_t r2 = (int64_t)width * width << 30; // (width/2)^2 in 32.32
+  const int32_t x = ((int32_t)cx << 16) + 0x8000;
+
+  // rows whose centers lie in [cy - width/2, cy + width/2)
+  for (int dy = -(width / 2); dy <= (width - 1) / 2; dy++) {
+    const int32_t hw = GRAPH_Sqrt(r2 - ((int64_t)dy * dy << 32));
+    GRAPH_FillSpan(x - hw, x + hw, cy + dy, color);
+  }
+}
+/**
+ * @brief Prepares a polygon edge for stepping from row to row.
+ *
+ * @details The edge crosses the rows whose centers lie between
+ * the Y coordinates of its ends (the top one included). X is
+ * calculated exactly at the center of the first row and then
+ * changed by a constant step on every row.
+ *
+ * @param e Edge to fill
+ * @param x0 X coordinate of first end (16.16 fixed point, on screen)
+ * @param y0 Y coordinate of first end (16.16 fixed point, on screen)
+ * @param x1 X coordinate of second end (16.16 fixed point, on screen)
+ * @param y1 Y coordinate of second end (16.16 fixed point, on screen)
+ * @retval 1 Edge crosses at least one row
+ * @retval 0 Edge crosses no row (e.g. it is horizontal)
+ */
+static int GRAPH_InitEdge(GRAPH_EdgeStruct* e, int32_t x0, int32_t y0,
+    int32_t x1, int32_t y1) {
+
+  int32_t t;
+
+  e->dir = 1;
+  if (y0 > y1) {
+    t = x0; x0 = x1; x1 = t;
+    t = y0; y0 = y1; y1 = t;
+    e->dir = -1;
+  }
+
+  e->first = (y0 - 0x8000 + 0xffff) >> 16;
+  e->last = (y1 - 0x8000 + 0xffff) >> 16;
+  if (e->first >= e->last) {
+    return 0;
+  }
+
+  const int32_t yc = ((int32_t)e->first << 16) + 0x8000;
+  const int64_t start = (int64_t)(yc - y0) * (x1 - x0);
+  const int64_t step = (int64_t)(x1 - x0) << 16;
+  int64_t q;
+
+  e->den = y1 - y0;
+
+  // divisions rounded down, so the remainders are not negative
+  q = start / e->den;
+  q -= (start - q * e->den < 0);
+  e->x = x0 + (int32_t)q;
+  e->err = (uint32_t)(start - q * e->den);
+
+  q = step / e->den;
+  q -= (step - q * e->den < 0);
+  e->dx = (int32_t)q;
+  e->rem = (uint32_t)(step - q * e->den);
+
+  return 1;
+}
+/**
+ * @brief Moves a polygon edge to the next row.
+ * @param e Edge
+ */
+static void GRAPH_StepEdge(GRAPH_EdgeStruct* e) {
+
+  e->x += e->dx;
+  e->err += e->rem;
+  if (e->err >= e->den) {
+    e->err -= e->den;
+    e->x++;
+  }
+}
+/**
+ * @brief Moves a polygon edge down by a number of rows.
+ * @param e Edge
+ * @param rows Number of rows
+ */
+static void GRAPH_SkipEdge(GRAPH_EdgeStruct* e, int rows) {
+
+  const uint64_t err = (uint64_t)e->rem * rows + e->err;
+
+  e->x += e->dx * rows + (int32_t)(err / e->den);
+  e->err = (uint32_t)(err % e->den);
+}
+/**
+ * @brief Fills a span of a row between two edges.
+ *
+ * @details Pixels whose centers lie between left (included)
+ * and right (excluded) are filled.
+ *
+ * @param left Left end of span (16.16 fixed point, on screen)
+ * @param right Right end of span (16.16 fixed point, on screen)
+ * @param row Row
+ * @param color Color (RGB565)
+ */
+static void GRAPH_FillSpan(int32_t left, int32_t right, int row,
+    uint16_t color) {
+
+  const int x0 = (left - 0x8000 + 0xffff) >> 16;
+  const int x1 = (right - 0x8000 + 0xffff) >> 16;
+
+  if (x0 < x1) {
+    GRAPH_FillRect(x0, row, x1 - x0, 1, color);
+  }
+}
+/**
+ * @brief Fills a polygon with horizontal spans.
+ *
+ * @details A scanline filler with an active edge table. The edges
+ * are sorted by their first row, become active when the scanned row
+ * reaches them and are dropped after their last row, so every row
+ * only looks at the edges which cross it. The X coordinates of active
+ * edges are stepped in fixed point (no division per row) and kept
+ * sorted - they change order only where edges cross, so the insertion
+ * sort rarely moves anything.
+ *
+ * A pixel is filled if its center is inside the polygon (the left
+ * and top edges included), using the non-zero winding rule, so
+ * concave and self-intersecting polygons are filled as well.
+ *
+ * @param vx X coordinates of vertices (16.16 fixed point, on screen)
+ * @param vy Y coordinates of vertices (16.16 fixed point, on screen)
+ * @param n Number of vertices (at most GRAPH_MAX_EDGES)
+ * @param color Color (RGB565)
+ */
+static void GRAPH_FillPolygon(const int32_t* vx, const int32_t* vy, int n,
+    uint16_t color) {
+
+  GRAPH_EdgeStruct* const edges = polyEdges;
+  GRAPH_EdgeStruct** const active = polyActive;
+  GRAPH_EdgeStruct tmp;
+  GRAPH_EdgeStruct* e;
+  int count = 0;
+  int activeCount = 0;
+  int next = 0;
+  int first = INT32_MAX;
+  int last = INT32_MIN;
+  int i, j, winding;
+  int32_t left = 0;
+
+  // edge table sorted by first row
+  for (i = 0; i < n; i++) {
+    j = (i + 1 < n) ? i + 1 : 0;
+    if (!GRAPH_InitEdge(&tmp, vx[i], vy[i], vx[j], vy[j])) {
+      continue;
+    }
+    first = (tmp.first < first) ? tmp.first : first;
+    last = (tmp.last > last) ? tmp.last : last;
+    for (j = count; j > 0 && edges[j - 1].first > tmp.first; j--) {
+      edges[j] = edges[j - 1];
+    }
+    edges[j] = tmp;
+    count++;
+  }
+
+  first = (first < clip.y0) ? clip.y0 : first;
+  last = (last > clip.y1) ? clip.y1 : last;
+
+  for (int row = first; row < last; row++) {
+
+    // drop finished edges
+    for (i = 0, j = 0; i < activeCount; i++) {
+      if (active[i]->last > row) {
+        active[j++] = active[i];
+      }
+    }
+    activeCount = j;
+
+    // add edges starting in this row (or above the clip rectangle)
+    while (next < count && edges[next].first <= row) {
+      e = &edges[next++];
+      if (e->last > row) {
+        GRAPH_SkipEdge(e, row - e->first);
+        active[activeCount++] = e;
+      }
+    }
+
+    // keep the active edges sorted by X
+    for (i = 1; i < activeCount; i++) {
+      e = active[i];
+      for (j = i; j > 0 && active[j - 1]->x > e->x; j--) {
+        active[j] = active[j - 1];
+      }
+      active[j] = e;
+    }
+
+    winding = 0;
+    for (i = 0; i < activeCount; i++) {
+      e = active[i];
+      if (winding == 0) {
+        left = e->x;
+      }
+      winding += e->dir;
+      if (winding == 0) {
+        GRAPH_FillSpan(left, e->x, row, color);
+      }
+      GRAPH_StepEdge(e);
+    }
+  }
+}
+/**
+ * @brief Fills a triangle with horizontal spans.
+ *
+ * @details The vertices are sorted by Y, so no edge table is needed:
+ * the long edge from the top to the bottom vertex is one side of every
+ * span, and the two short edges (above and below the middle vertex)
+ * are the other side. Same fill rule as GRAPH_FillPolygon().
+ *
+ * @param vx X coordinates of vertices (16.16 fixed point, on screen)
+ * @param vy Y coordinates of vertices (16.16 fixed point, on screen)
+ * @param color Color (RGB565)
+ */
+static void GRAPH_FillTriangle(const int32_t* vx, const int32_t* vy,
+    uint16_t color) {
+
+  GRAPH_EdgeStruct longEdge;
+  GRAPH_EdgeStruct shortEdge[2];
+  int a = 0, b = 1, c = 2, t;
+  int longRow; // row of the current X of the long edge
+
+  // a - top, b - middle, c - bottom vertex
+  if (vy[a] > vy[b]) { t = a; a = b; b = t; }
+  if (vy[b] > vy[c]) { t = b; b = c; c = t; }
+  if (vy[a] > vy[b]) { t = a; a = b; b = t; }
+
+  if (!GRAPH_InitEdge(&longEdge, vx[a], vy[a], vx[c], vy[c])) {
+    return;
+  }
+  longRow = longEdge.first;
+
+  // is the middle vertex right of the long edge
+  const int right = (int64_t)(vx[b] - vx[a]) * (vy[c] - vy[a]) >
+      (int64_t)(vy[b] - vy[a]) * (vx[c] - vx[a]);
+
+  GRAPH_InitEdge(&shortEdge[0], vx[a], vy[a], vx[b], vy[b]);
+  GRAPH_InitEdge(&shortEdge[1], vx[b], vy[b], vx[c], vy[c]);
+
+  for (int k = 0; k < 2; k++) {
+
+    GRAPH_EdgeStruct* e = &shortEdge[k];
+    const int from = (e->first > clip.y0) ? e->first : clip.y0;
+    const int to = (e->last < clip.y1) ? e->last : clip.y1;
+
+    if (from >= to) {
+      continue;
+    }
+
+    GRAPH_SkipEdge(e, from - e->first);
+    GRAPH_SkipEdge(&longEdge, from - longRow);
+    longRow = to;
+
+    for (int row = from; row < to; row++) {
+      if (right) {
+        GRAPH_FillSpan(longEdge.x, e->x, row, color);
+      } else {
+        GRAPH_FillSpan(e->x, longEdge.x, row, color);
+      }
+      GRAPH_StepEdge(&longEdge);
+      GRAPH_StepEdge(e);
+    }
+  }
+}
+/**
+ * @brief Reads the headers (and palette) of a BMP file.
+ * @param file Opened file
+ * @param bmp Header to fill
+ * @param palette Palette converted to RGB565 (for 8 bit images)
+ * @retval 0 Supported image
+ * @retval -1 Read error
+ * @retval -2 Unsupported format
+ */
+static int GRAPH_ReadBmpHeader(int file, BMP_File* bmp, uint16_t* palette) {
+
+  uint8_t raw[GRAPH_BMP_HEADER];
+  uint8_t entry[4];
+
+  if (FAT_ReadFile(file, raw, GRAPH_BMP_HEADER) < 54) {
+    return -1;
+  }
+
+  bmp->signature = GRAPH_Get16(raw);
+  bmp->size = GRAPH_Get32(raw + 2);
+  bmp->reserved = GRAPH_Get32(raw + 6);
+  bmp->dataOffset = GRAPH_Get32(raw + 10);
+  bmp->headerSize = GRAPH_Get32(raw + 14);
+  bmp->width = (int32_t)GRAPH_Get32(raw + 18);
+  bmp->height = (int32_t)GRAPH_Get32(raw + 22);
+  bmp->planes = GRAPH_Get16(raw + 26);
+  bmp->bitsPerPixel = GRAPH_Get16(raw + 28);
+  bmp->compressionType = GRAPH_Get32(raw + 30);
+  bmp->imageSize = GRAPH_Get32(raw + 34);
+  bmp->resolutionH = GRAPH_Get32(raw + 38);
+  bmp->resolutionV = GRAPH_Get32(raw + 42);
+  bmp->colorsInImage = GRAPH_Get32(raw + 46);
+  bmp->importantColors = GRAPH_Get32(raw + 50);
+  bmp->redMask = GRAPH_Get32(raw + 54);
+  bmp->greenMask = GRAPH_Get32(raw + 58);
+  bmp->blueMask = GRAPH_Get32(raw + 62);
+
+  if (bmp->signature != 0x4d42 || bmp->width <= 0 || bmp->height == 0) {
+    return -2;
+  }
+
+  switch (bmp->bitsPerPixel) {
+  case 24:
+    return (bmp->compressionType == 0) ? 0 : -2;
+  case 16:
+    if (bmp->compressionType == 0) {
+      // no masks in file - the default layout is X1R5G5B5
+      bmp->redMask = 0x7c00;
+      bmp->greenMask = 0x03e0;
+      bmp->blueMask = 0x001f;
+      return 0;
+    }
+    // only the layouts GRAPH_StreamBmp() converts
+    if (bmp->compressionType == 3 && bmp->blueMask == 0x001f &&
+        ((bmp->redMask == 0xf800 && bmp->greenMask == 0x07e0) ||
+         (bmp->redMask == 0x7c00 && bmp->greenMask == 0x03e0))) {
+      return 0;
+    }
+    return -2;
+  case 8:
+    if (bmp->compressionType != 0 || bmp->colorsInImage > 256) {
+      return -2;
+    }
+    break;
+  default:
+    return -2;
+  }
+
+  // palette of B, G, R, 0 entries after the info header
+  if (FAT_MoveRdPtr(file, 14 + bmp->headerSize) < 0) {
+    return -1;
+  }
+  const int colors = bmp->colorsInImage ? bmp->colorsInImage : 256;
+  memset(palette, 0, 256 * sizeof(uint16_t));
+  for (int i = 0; i < colors; i++) {
+    if (FAT_ReadFile(file, entry, 4) != 4) {
+      return -1;
+    }
+    palette[i] = GRAPH_RGB(entry[2], entry[1], entry[0]);
+  }
+
+  return 0;
+}
+/**
+ * @brief Sends the visible part of a BMP image to the current target.
+ *
+ * @details Every visible row is read from the file, converted to RGB565
+ * and sent by DMA while the next one is read. A window crossing the
+ * scroll seam of the LCD is written as two single row bursts per row,
+ * so the file is still read only once.
+ *
+ * @param file Opened file
+ * @param bmp Header of file
+ * @param palette Palette (8 bit images)
+ * @param px X coordinate of top left corner on screen
+ * @param py Y coordinate of top left corner on screen
+ * @retval 0 Image drawn
+ * @retval -1 Read error
+ */
+static int GRAPH_StreamBmp(int file, const BMP_File* bmp,
+    const uint16_t* palette, int px, int py) {
+
+  uint16_t* buf;
+  const uint8_t* p;
+  int ret = 0;
+
+  const int bottomUp = (bmp->height > 0);
+  const int rows = bottomUp ? bmp->height : -bmp->height;
+  const int bytes = bmp->bitsPerPixel / 8;
+  const uint32_t stride = ((uint32_t)bmp->width * bytes + 3) & ~3;
+
+  // visible rows and columns of the image
+  const int first = (clip.y0 > py) ? clip.y0 - py : 0;
+  const int last = (clip.y1 - py < rows) ? clip.y1 - py : rows;
+  const int left = (clip.x0 > px) ? clip.x0 - px : 0;
+  const int right = (clip.x1 - px < bmp->width) ? clip.x1 - px : bmp->width;
+  const int w = right - left;
+
+  if (first >= last || left >= right) {
+    return 0;
+  }
+
+  // a window can not cross the scroll seam of the LCD
+  const int seam = (target == GRAPH_TARGET_LCD) ?
+      GRAPH_Seam(px + left, px + right) : 0;
+
+  if (!seam) {
+    if (bottomUp) {
+      GRAPH_BlitBeginBottomUp(px + left, py + first, w, last - first);
+    } else {
+      GRAPH_BlitBegin(px + left, py + first, w, last - first);
+    }
+  }
+
+  for (int i = 0; i < last - first; i++) {
+
+    // row of the image, in the order of the file
+    const int row = bottomUp ? last - 1 - i : first + i;
+    const uint32_t offset = bmp->dataOffset +
+        (bottomUp ? rows - 1 - row : row) * stride + left * bytes;
+
+    // the read pointer only moves forward
+    if (FAT_MoveRdPtr(file, offset) < 0 ||
+        FAT_ReadFile(file, bmpRaw, w * bytes) != w * bytes) {
+      ret = -1;
+      break;
+    }
+
+    // one converted row is sent by DMA while the next one is read
+    buf = lineBuf[i & 1].h;
+    p = bmpRaw;
+    switch (bmp->bitsPerPixel) {
+    case 24:
+      for (int j = 0; j < w; j++, p += 3) { // B, G, R
+        buf[j] = dither ?
+            GRAPH_Dither(p[2], p[1], p[0], px + left + j, py + row) :
+            GRAPH_RGB(p[2], p[1], p[0]);
+      }
+      break;
+    case 16:
+      for (int j = 0; j < w; j++, p += 2) {
+        const uint16_t c = p[0] | (p[1] << 8);
+        // X1R5G5B5 - the top bit of green is repeated in the new bit
+        buf[j] = (bmp->greenMask == 0x07e0) ? c :
+            ((c & 0x7fe0) << 1) | ((c >> 4) & 0x0020) | (c & 0x001f);
+      }
+      break;
+    default:
+      for (int j = 0; j < w; j++) {
+        buf[j] = palette[p[j]];
+      }
+      break;
+    }
+
+    // waits for the previous row to be sent
+    if (!seam) {
+      GRAPH_BlitPixelsAsync(buf, w);
+    } else {
+      GRAPH_BlitBegin(px + left, py + row, seam - px - left, 1);
+      GRAPH_BlitPixelsAsync(buf, seam - px - left);
+      GRAPH_BlitBegin(seam, py + row, px + right - seam, 1);
+      GRAPH_BlitPixelsAsync(buf + seam - px - left, px + right - seam);
+    }
+  }
+
+  GRAPH_BlitEnd(); // waits for the last row to be sent
+  return ret;
+}
+/**
+ * @brief Sends the visible part of an RLE image to the opened window.
+ *
+ * @details Packets are decoded from the start of the image, the ones
+ * before the first visible row are only skipped. When the image is not
+ * clipped on the sides, the visible part of a packet is a single write
+ * to the window, so a run is one fill of the LCD, even if it covers
+ * many rows. Otherwise every row of a packet is clipped separately.
+ *
+ * @param img Image (RLE565 or RLE8)
+ * @param first First visible row
+ * @param last Row after the last visible one
+ * @param left First visible column
+ * @param right Column after the last visible one
+ */
+static void GRAPH_DecodeRle(const GRAPH_ImageStruct* img, int first,
+    int last, int left, int right) {
+
+  const void* src = img->data;
+  const uint32_t columns = img->columns;
+  const uint32_t start = first * columns; // first visible pixel
+  const uint32_t end = last * columns;    // pixel after the last visible one
+  const uint8_t whole = (left == 0 && right == img->columns);
+  GRAPH_RlePacketStruct packet;
+  uint32_t pos = 0; // first pixel of the current packet
+  int buf = 0;
+
+  while (pos < end) {
+
+    src = GRAPH_ReadRlePacket(img, src, &packet);
+
+    // visible pixels of packet - a single piece or a piece in every row
+    uint32_t i = (pos < start) ? start : pos;
+    const uint32_t packetEnd = (pos + packet.n < end) ? pos + packet.n : end;
+
+    while (i < packetEnd) {
+      uint32_t from = i;
+      uint32_t to = packetEnd;
+      if (!whole) {
+        const uint32_t rowStart = i - i % columns;
+        to = (rowStart + columns < packetEnd) ? rowStart + columns : packetEnd;
+        if (from < rowStart + left) {
+          from = rowStart + left;
+        }
+        if (to > rowStart + right) {
+          to = rowStart + right;
+        }
+        i = (rowStart + columns < packetEnd) ? rowStart + columns : packetEnd;
+      } else {
+        i = packetEnd;
+      }
+      if (from < to) {
+        GRAPH_SendRlePixels(img, &packet, from - pos, to - from, &buf);
+      }
+    }
+
+    pos += packet.n;
+  }
+}
+/**
+ * @brief Sends a piece of an RLE image drawn in pieces of columns.
+ *
+ * @details Rows are decoded separately. The first piece decodes the
+ * image from its start, later ones continue every row at the packet
+ * saved in rleResume by the previous piece, so each packet is read
+ * about once for the whole image. A piece not following the previous
+ * one (e.g. the first piece) is decoded from the start of the image.
+ *
+ * @param img Image (RLE565 or RLE8)
+ * @param first First visible row
+ * @param last Row after the last visible one
+ * @param left First visible column
+ * @param right Column after the last visible one
+ */
+static void GRAPH_DecodeRlePiece(const GRAPH_ImageStruct* img, int first,
+    int last, int left, int right) {
+
+  const uint8_t resume = (left == rleResume.next);
+  const void* src = img->data;
+  const void* next;
+  GRAPH_RlePacketStruct packet;
+  uint32_t pos = 0; // first pixel of the current packet
+  int buf = 0;
+
+  for (int row = first; row < last; row++) {
+
+    const uint32_t from = row * img->columns + left;
+    const uint32_t to = row * img->columns + right;
+
+    if (resume) {
+      src = rleResume.src[row - first];
+      pos = rleResume.pos[row - first];
+    }
+
+    // stops at the packet holding the first pixel after the piece
+    while (pos < to) {
+      next = GRAPH_ReadRlePacket(img, src, &packet);
+      if (pos + packet.n > from) {
+        const uint32_t a = (pos > from) ? pos : from;
+        const uint32_t b = (pos + packet.n < to) ? pos + packet.n : to;
+        GRAPH_SendRlePixels(img, &packet, a - pos, b - a, &buf);
+      }
+      if (pos + packet.n > to) {
+        break;
+      }
+      src = next;
+      pos += packet.n;
+    }
+
+    rleResume.src[row - first] = src;
+    rleResume.pos[row - first] = pos;
+  }
+
+  rleResume.next = right;
+}
+/**
+ * @brief Reads the header and colors of a packet of an RLE image.
+ * @param img Image (RLE565 or RLE8)
+ * @param src Header of packet
+ * @param packet Decoded packet
+ * @return Header of the next packet
+ */
+static const void* GRAPH_ReadRlePacket(const GRAPH_ImageStruct* img,
+    const void* src, GRAPH_RlePacketStruct* packet) {
+
+  if (img->format == GRAPH_IMAGE_RLE565) {
+    const uint16_t* src16 = src;
+    packet->isRun = (*src16 & 0x8000) != 0;
+    packet->n = (*src16++ & 0x7fff) + 1;
+    if (packet->isRun) {
+      packet->color = *src16++;
+    } else {
+      packet->literal = src16;
+      src16 += packet->n;
+    }
+    return src16;
+  }
+
+  const uint8_t* src8 = src;
+  packet->isRun = (*src8 & 0x80) != 0;
+  packet->n = *src8 & 0x3f;
+  if (*src8++ & 0x40) {
+    packet->n = (packet->n << 8) | *src8++;
+  }
+  packet->n++;
+  if (packet->isRun) {
+    packet->color = img->palette[*src8++];
+  } else {
+    packet->literal = src8;
+    src8 += packet->n;
+  }
+  return src8;
+}
+/**
+ * @brief Sends pixels of an RLE packet to the opened window.
+ *
+ * @details A run is a single fill. Literals of RLE565 images are sent
+ * straight from their data, indices of RLE8 images are converted to
+ * colors in two buffers - one is sent while the other one is converted.
+ *
+ * @param img Image (RLE565 or RLE8)
+ * @param packet Packet
+ * @param offset First pixel to send (from the start of packet)
+ * @param n Number of pixels
+ * @param buf Buffer to convert to next (toggled after every use)
+ */
+static void GRAPH_SendRlePixels(const GRAPH_ImageStruct* img,
+    const GRAPH_RlePacketStruct* packet, uint32_t offset, uint32_t n,
+    int* buf) {
+
+  if (packet->isRun) {
+    GRAPH_BlitFill(packet->color, n);
+    return;
+  }
+
+  if (img->format == GRAPH_IMAGE_RLE565) {
+    GRAPH_BlitPixelsAsync((const uint16_t*)packet->literal + offset, n);
+    return;
+  }
+
+  const uint8_t* literal = (const uint8_t*)packet->literal + offset;
+
+  for (uint32_t j = 0; j < n; j += ILI9320_WIDTH) {
+    const uint32_t count = (n - j < ILI9320_WIDTH) ? n - j : ILI9320_WIDTH;
+    for (uint32_t k = 0; k < count; k++) {
+      lineBuf[*buf].h[k] = img->palette[literal[j + k]];
+    }
+    GRAPH_BlitPixelsAsync(lineBuf[*buf].h, count);
+    *buf ^= 1;
+  }
+}
+/**
+ * @brief Gives the number of bits of a pixel of an indexed image.
+ * @param format Format of image
+ * @return Bits per pixel (1, 2, 4 or 8) or 0 if image is not indexed
+ */
+static int GRAPH_IndexBits(GRAPH_ImageFormat format) {
+
+  switch (format) {
+  case GRAPH_IMAGE_INDEX1:
+    return 1;
+  case GRAPH_IMAGE_INDEX2:
+    return 2;
+  case GRAPH_IMAGE_INDEX4:
+    return 4;
+  case GRAPH_IMAGE_INDEX8:
+    return 8;
+  default:
+    return 0;
+  }
+}
+/**
+ * @brief Builds the expansion table for the palette of an image.
+ *
+ * @details The table is kept until an image with another palette
+ * (or format) is drawn, so icons sharing a palette build it once.
+ * Palettes are constant - a palette changed in place is not noticed.
+ *
+ * @param img Indexed image
+ */
+static void GRAPH_BuildLut(const GRAPH_ImageStruct* img) {
+
+  const GRAPH_Color* pal = img->palette;
+
+  if (img->format == GRAPH_IMAGE_INDEX8 ||
+      (lut.palette == pal && lut.format == img->format)) {
+    return;
+  }
+
+  if (img->format == GRAPH_IMAGE_INDEX4) {
+    for (int b = 0; b < 256; b++) {
+      lut.pixels[b][0] = pal[b >> 4] | ((uint32_t)pal[b & 0x0f] << 16);
+    }
+  } else if (img->format == GRAPH_IMAGE_INDEX2) {
+    for (int b = 0; b < 256; b++) {
+      lut.pixels[b][0] = pal[b >> 6] | ((uint32_t)pal[(b >> 4) & 0x03] << 16);
+      lut.pixels[b][1] = pal[(b >> 2) & 0x03] | ((uint32_t)pal[b & 0x03] << 16);
+    }
+  } else {
+    for (int b = 0; b < 16; b++) { // nibbles
+      lut.pixels[b][0] = pal[b >> 3] | ((uint32_t)pal[(b >> 2) & 0x01] << 16);
+      lut.pixels[b][1] = pal[(b >> 1) & 0x01] | ((uint32_t)pal[b & 0x01] << 16);
+    }
+  }
+
+  lut.palette = pal;
+  lut.format = img->format;
+}
+/**
+ * @brief Expands bytes of an indexed image to pixels.
+ * @param img Indexed image (its table has to be built)
+ * @param src Bytes of indices
+ * @param n Number of bytes
+ * @param line Pixels (as many as the bytes hold)
+ */
+static void GRAPH_ExpandIndices(const GRAPH_ImageStruct* img,
+    const uint8_t* src, int n, GRAPH_LineUnion* line) {
+
+  uint32_t* dst = line->w;
+
+  switch (img->format) {
+  case GRAPH_IMAGE_INDEX1:
+    for (int i = 0; i < n; i++) {
+      const uint32_t* hi = lut.pixels[src[i] >> 4];
+      const uint32_t* lo = lut.pixels[src[i] & 0x0f];
+      *dst++ = hi[0];
+      *dst++ = hi[1];
+      *dst++ = lo[0];
+      *dst++ = lo[1];
+    }
+    break;
+  case GRAPH_IMAGE_INDEX2:
+    for (int i = 0; i < n; i++) {
+      *dst++ = lut.pixels[src[i]][0];
+      *dst++ = lut.pixels[src[i]][1];
+    }
+    break;
+  case GRAPH_IMAGE_INDEX4:
+    for (int i = 0; i < n; i++) {
+      *dst++ = lut.pixels[src[i]][0];
+    }
+    break;
+  default:
+    for (int i = 0; i < n; i++) {
+      line->h[i] = img->palette[src[i]];
+    }
+    break;
+  }
+}
+/**
+ * @brief Draws the visible part of an indexed image.
+ *
+ * @details Rows are expanded from whole bytes, so a clipped row starts
+ * up to 7 pixels before the first visible one. One row is sent while
+ * the next one is expanded. With a transparent index every row is
+ * broken into spans of other indices, each written to its own window
+ * (whole bytes of the transparent index are skipped at once).
+ *
+ * @param img Image (INDEX1 - INDEX8)
+ * @param px X coordinate of image on screen
+ * @param py Y coordinate of image on screen
+ * @param first First visible row
+ * @param last Row after the last visible one
+ * @param left First visible column
+ * @param right Column after the last visible one
+ */
+static void GRAPH_DrawIndexed(const GRAPH_ImageStruct* img, int px, int py,
+    int first, int last, int left, int right) {
+
+  const int bits = GRAPH_IndexBits(img->format);
+  const int mask = (1 << bits) - 1;
+  const int perByte = 8 / bits;
+  const int stride = (img->columns * bits + 7) / 8;
+  const int start = left / perByte; // byte of the first visible pixel
+  const int bytes = (right + perByte - 1) / perByte - start;
+  const int skip = left - start * perByte; // pixels before it in the byte
+  const uint8_t transparent = img->transparent && img->key <= mask;
+  // a byte of transparent pixels only
+  const uint8_t keyByte = (0xff / mask) * img->key;
+  int buf = 0;
+
+  GRAPH_BuildLut(img);
+
+  if (!transparent) {
+    GRAPH_BlitBegin(px + left, py + first, right - left, last - first);
+  }
+
+  for (int i = first; i < last; i++) { // rows
+
+    const uint8_t* row = (const uint8_t*)img->data + i * stride;
+    GRAPH_ExpandIndices(img, row + start, bytes, &lineBuf[buf]);
+    const uint16_t* pixels = lineBuf[buf].h + skip; // first visible pixel
+
+    if (!transparent) {
+      // waits for the previous row to be sent
+      GRAPH_BlitPixelsAsync(pixels, right - left);
+      buf ^= 1;
+      continue;
+    }
+
+    uint8_t sent = 0;
+    int j = left;
+    while (j < right) {
+      // transparent pixels
+      while (j < right) {
+        const int bit = j * bits;
+        if ((bit & 7) == 0 && row[bit >> 3] == keyByte) {
+          j += perByte;
+        } else if (((row[bit >> 3] >> (8 - bits - (bit & 7))) & mask) ==
+            img->key) {
+          j++;
+        } else {
+          break;
+        }
+      }
+      if (j >= right) {
+        break;
+      }
+      // span of drawn pixels
+      const int from = j;
+      while (j < right) {
+        const int bit = j * bits;
+        if (((row[bit >> 3] >> (8 - bits - (bit & 7))) & mask) == img->key) {
+          break;
+        }
+        j++;
+      }
+      GRAPH_BlitBegin(px + from, py + i, j - from, 1);
+      GRAPH_BlitPixelsAsync(pixels + from - left, j - from);
+      sent = 1;
+    }
+    // the buffer is reused only after the next one was sent
+    if (sent) {
+      buf ^= 1;
+    }
+  }
+
+  GRAPH_BlitEnd(); // waits for the last row to be sent
+}
+/**
+ * @brief Sends a block of a JPEG image to the current target.
+ *
+ * @details The visible part of block is written to a window (two
+ * if it crosses the scroll seam) without waiting for the end of
+ * transfer - the next window waits for it, so the decoder may reuse
+ * the pixels as soon as this function returns for the next block.
+ *
+ * @param x X coordinate of block in image
+ * @param y Y coordinate of block in image
+ * @param w Width of block
+ * @param h Height of block
+ * @param pixels Pixels of block (RGB565)
+ */
+static void GRAPH_JpegBlock(int x, int y, int w, int h,
+    const uint16_t* pixels) {
+
+  const int px = jpegX + x;
+  const int py = jpegY + y;
+
+  // visible rows and columns of the block
+  const int first = (clip.y0 > py) ? clip.y0 - py : 0;
+  const int last = (clip.y1 - py < h) ? clip.y1 - py : h;
+  const int left = (clip.x0 > px) ? clip.x0 - px : 0;
+  const int right = (clip.x1 - px < w) ? clip.x1 - px : w;
+
+  if (first >= last || left >= right) {
+    GRAPH_BlitEnd(); // the previous block has to be sent
+    return;
+  }
+
+  // a window can not cross the scroll seam of the LCD
+  const int seam = (target == GRAPH_TARGET_LCD) ?
+      GRAPH_Seam(px + left, px + right) : 0;
+  const int cut[3] = {left, seam ? seam - px : right, right};
+
+  for (int i = 0; i < (seam ? 2 : 1); i++) {
+    const int width = cut[i + 1] - cut[i];
+    GRAPH_BlitBegin(px + cut[i], py + first, width, last - first);
+    if (width == w) {
+      GRAPH_BlitPixelsAsync(pixels + first * w, (last - first) * w);
+    } else {
+      for (int j = first; j < last; j++) {
+        GRAPH_BlitPixelsAsync(pixels + j * w + cut[i], width);
+      }
+    }
+  }
+}
+/**
+ * @brief Reads a little endian 32 bit value.
+ * @param p Bytes
+ * @return Value
+ */
+static uint32_t GRAPH_Get32(const uint8_t* p) {
+
+  return p[0] | (p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+/**
+ * @brief Reads a little endian 16 bit value.
+ * @param p Bytes
+ * @return Value
+ */
+static uint16_t GRAPH_Get16(const uint8_t* p) {
+
+  return p[0] | (p[1] << 8);
+}
+/**
+ * @brief Integer square root.
+ * @param v Value
+ * @return Largest integer whose square is not greater than v.
+ */
+static uint32_t GRAPH_Sqrt(uint64_t v) {
+
+  uint64_t root = 0;
+  uint64_t bit = 1ULL << 62;
+
+  while (bit > v) {
+    bit >>= 2;
+  }
+  while (bit) {
+    if (v >= root + bit) {
+      v -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+
+  return (uint32_t)root;
+}
+/**
+ * @brief Converts a 24 bit color with ordered dithering.
+ *
+ * @details A threshold from a 4x4 Bayer matrix (0-15, selected by the
+ * position on screen) is scaled to the bits lost by every component
+ * (3 for red and blue, 2 for green) and added before truncating.
+ *
+ * @param r Red
+ * @param g Green
+ * @param b Blue
+ * @param x X coordinate of pixel
+ * @param y Y coordinate of pixel
+ * @return Color (RGB565)
+ */
+static GRAPH_Color GRAPH_Dither(uint8_t r, uint8_t g, uint8_t b, int x, int y) {
+
+  static const uint8_t bayer[4][4] = {
+      { 0,  8,  2, 10},
+      {12,  4, 14,  6},
+      { 3, 11,  1,  9},
+      {15,  7, 13,  5},
+  };
+  const uint8_t t = bayer[y & 3][x & 3];
+  const int rd = r + (t >> 1);
+  const int gd = g + (t >> 2);
+  const int bd = b + (t >> 1);
+
+  return GRAPH_RGB(rd > 255 ? 255 : rd, gd > 255 ? 255 : gd,
+      bd > 255 ? 255 : bd);
 }
 
 /**
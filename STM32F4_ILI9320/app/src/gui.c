@@ -19,6 +19,7 @@
 
 #include <graphics.h>
 #include <tsc2046.h>
+#include <dirty.h>
 #include <font_8x16.h>
 
 /**
@@ -26,6 +27,27 @@
  * @{
  */
 
+#define GUI_BUTTON_RADIUS 8   ///< Radius of button corners
+#define GUI_BUTTON_COLOR  GRAPH_RGB(0xff, 0xff, 0x00) ///< Color of buttons
+#define GUI_BORDER_COLOR  GRAPH_RGB(0x80, 0x80, 0x00) ///< Color of button borders
+#define GUI_MAX_BUTTONS   20  ///< Maximum number of buttons
+
+/**
+ * @brief Button drawn on the screen.
+ */
+typedef struct {
+  uint16_t x;       ///< X coordinate of button origin
+  uint16_t y;       ///< Y coordinate of button origin
+  uint16_t w;       ///< Width of button
+  uint16_t h;       ///< Height of button
+  const char* text; ///< Description of button
+} GUI_ButtonTypeDef;
+
+static GUI_ButtonTypeDef buttons[GUI_MAX_BUTTONS]; ///< Added buttons
+static uint8_t buttonCount;                        ///< Number of added buttons
+
+static void GUI_DrawButton(const GUI_ButtonTypeDef* button);
+static void GUI_Redraw(int x, int y, int w, int h);
 static void GUI_ConvertLCD2TSC(uint16_t *x, uint16_t *y, uint16_t *w, uint16_t *h);
 
 /**
@@ -38,13 +60,16 @@ void GUI_Init(void) {
   GRAPH_SetColor(0xff, 0xff, 0x00);
   GRAPH_SetBgColor(0xff, 0x00, 0x00);
   GRAPH_SetFont(font8x16Info);
+  DIRTY_SetRedraw(GUI_Redraw);
 }
 
 
 /**
  * @brief Adds a button to the GUI.
  *
- * @details All coordinates as per LCD (not TSC).
+ * @details All coordinates as per LCD (not TSC). The button is
+ * redrawn by DIRTY_Flush() when its area is invalidated (only
+ * the first GUI_MAX_BUTTONS buttons).
  *
  * @param x X coordinate of button origin.
  * @param y Y coordinate of button origin.
@@ -56,10 +81,14 @@ void GUI_Init(void) {
 void GUI_AddButton(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
     void (*cb)(uint16_t x, uint16_t y), const char* text) {
 
-  GRAPH_DrawRectangle(x,y,w,h);
+  const GUI_ButtonTypeDef button = { x, y, w, h, text };
 
-  // TODO Derive position of button text from string and font size
-  GRAPH_DrawString(text, x+w/4, y+h/4);
+  GUI_DrawButton(&button);
+
+  // buttons over the limit work, but are not redrawn
+  if (buttonCount < GUI_MAX_BUTTONS) {
+    buttons[buttonCount++] = button;
+  }
 
   GUI_ConvertLCD2TSC(&x, &y, &w, &h);
 
@@ -78,6 +107,45 @@ void GUI_AddLabel(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
     const char* text) {
 
 }
+/**
+ * @brief Draws a button.
+ * @param button Button to draw.
+ */
+static void GUI_DrawButton(const GUI_ButtonTypeDef* button) {
+
+  GRAPH_SetColor565(GUI_BUTTON_COLOR);
+  GRAPH_DrawRoundedRectangle(button->x, button->y, button->w, button->h,
+      GUI_BUTTON_RADIUS);
+  GRAPH_SetColor565(GUI_BORDER_COLOR);
+  GRAPH_DrawRoundedBox(button->x, button->y, button->w, button->h,
+      GUI_BUTTON_RADIUS);
+  GRAPH_SetColor565(GUI_BUTTON_COLOR);
+
+  // TODO Derive position of button text from string and font size
+  GRAPH_DrawString(button->text, button->x + button->w/4,
+      button->y + button->h/4);
+}
+/**
+ * @brief Redraws widgets in an area of the screen.
+ *
+ * @details Called by DIRTY_Flush(). Widgets are drawn whole, so
+ * they can reach outside of the area.
+ *
+ * @param x X coordinate of area
+ * @param y Y coordinate of area
+ * @param w Width of area
+ * @param h Height of area
+ */
+static void GUI_Redraw(int x, int y, int w, int h) {
+
+  for (int i = 0; i < buttonCount; i++) {
+    const GUI_ButtonTypeDef* b = &buttons[i];
+    if (b->x < x + w && b->x + b->w > x &&
+        b->y < y + h && b->y + b->h > y) {
+      GUI_DrawButton(b);
+    }
+  }
+}
 
 /**
  * @brief Converts LCD coordinates (320x240) to TSC coordinates.
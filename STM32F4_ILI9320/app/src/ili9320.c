@@ -8,6 +8,19 @@
  * by 256 pixels vertically. My display has only 320x240 pixels,
  * however - the data wraps around.
  *
+ * The X axis of the display is the vertical GRAM address (register 0x21)
+ * and the Y axis is the horizontal GRAM address (register 0x20).
+ * The entry mode is set so that data streamed into a window fills it
+ * row by row: X increments first, then Y. This is the order expected
+ * by ILI9320_WriteBegin() and friends.
+ *
+ * The screen can be scrolled along the X axis by the base image
+ * scroll register (0x6A). The X coordinates used by the driver are
+ * logical - they are moved by the scroll amount to GRAM lines, so
+ * the logical X = 0 is always the first line shown. Logical lines
+ * from ILI9320_GetScrollSeam() on are placed at the beginning of
+ * the GRAM, so a window must not cross that line.
+ *
  * @verbatim
  * Copyright (c) 2014 Michal Ksiezopolski.
  * All rights reserved. This program and the 
@@ -22,6 +35,7 @@
 #include <ili9320.h>
 #include <timers.h>
 #include <stdio.h>
+#include <string.h>
 #include <ili9320_hal.h>
 
 /**
@@ -71,6 +85,15 @@
 #define ILI9320_DRIVER_OUTPUT2    0x60
 #define ILI9320_BASE_IMAGE        0x61
 #define ILI9320_VERTICAL_SCROLL   0x6a
+#define ILI9320_ENTRY_MODE_BGR    0x1000 ///< Red and blue swapped in GRAM
+#define ILI9320_ENTRY_MODE_ID0    0x0010 ///< Y incremented (decremented when cleared)
+#define ILI9320_BASE_IMAGE_VLE    0x0002 ///< Vertical scroll enabled
+#define ILI9320_BASE_IMAGE_REV    0x0001 ///< Grayscale inversion
+#define ILI9320_DISP1_PTDE1       0x2000 ///< Partial image 2 enabled
+#define ILI9320_DISP1_PTDE0       0x1000 ///< Partial image 1 enabled
+#define ILI9320_DISP1_BASEE       0x0100 ///< Base image enabled
+#define ILI9320_DISP4_FMARKOE     0x0008 ///< FMARK output enabled
+#define ILI9320_FRAME_RATE_FRS    0x000f ///< Frame rate selection bits
 #define ILI9320_PARTIAL1_POS      0x80
 #define ILI9320_PARTIAL1_START    0x81
 #define ILI9320_PARTIAL1_END      0x82
@@ -84,7 +107,74 @@
 #define ILI9320_PANEL_INTERFACE5  0x97
 #define ILI9320_PANEL_INTERFACE6  0x98
 
+#define ILI9320_REG_COUNT         256     ///< Size of register address space
+#define ILI9320_NO_INDEX          0xffff  ///< Contents of index register unknown
+#define ILI9320_FRAME_RATE_INIT   0x4010  ///< Frame rate register set at init
+#define ILI9320_ENTRY_MODE_INIT   0x1038  ///< Entry mode set at init (BGR, AM = 1, X and Y incremented)
+
+#define ILI9320_CALIB_PIXELS      (2 * ILI9320_HEIGHT) ///< Pixels written by a timing test
+#define ILI9320_CALIB_REPEAT      3       ///< Passes of a timing test
+#define ILI9320_CALIB_ROWS        16      ///< Rows of a timing test compared at once
+
+#define ILI9320_BACK_PORCH        2       ///< Lines of back porch (DISP2)
+#define ILI9320_FRONT_PORCH       2       ///< Lines of front porch (DISP2)
+/**
+ * @brief Lines scanned in a frame (display lines and porches).
+ */
+#define ILI9320_FRAME_LINES (ILI9320_WIDTH + ILI9320_BACK_PORCH + ILI9320_FRONT_PORCH)
+
 uint16_t ILI9320_RGBDecode(uint8_t r, uint8_t g, uint8_t b);
+static void ILI9320_RestoreWindow(void);
+static uint16_t ILI9320_PhysX(uint16_t x);
+static void ILI9320_WriteReg(uint16_t reg, uint16_t data);
+static void ILI9320_WriteIndex(uint16_t reg);
+static void ILI9320_SelectGRAM(void);
+static void ILI9320_SetShadow(uint16_t reg, uint16_t data);
+static void ILI9320_InvalidateShadow(void);
+static void ILI9320_FmarkCallback(void);
+static uint32_t ILI9320_ScanPosition(uint32_t* frame);
+static void ILI9320_ReadWindow(uint16_t x, uint16_t y, uint16_t width,
+    uint16_t height, uint16_t* buf, uint16_t stride);
+static int ILI9320_TestTiming(uint8_t addressSetup, uint8_t dataSetup);
+static void ILI9320_WritePattern(void);
+
+/**
+ * @brief Set if the work window is not the whole screen.
+ *
+ * @details Single pixel writes need the full screen window, so it is
+ * restored lazily before the next pixel is drawn.
+ */
+static uint8_t windowActive;
+static uint8_t bottomUp;              ///< Y decremented by the opened burst
+/**
+ * @brief GRAM line shown as the first line of the screen.
+ */
+static uint16_t scrollOffset;
+/**
+ * @brief Last values written to the control registers.
+ *
+ * @details Writes which would not change a register are skipped.
+ * The cursor registers are invalidated by every GRAM access, since
+ * the address counter moves then.
+ */
+static uint16_t regShadow[ILI9320_REG_COUNT];
+static uint32_t regValid[ILI9320_REG_COUNT / 32]; ///< Bit set if shadow is valid
+static uint16_t indexReg;           ///< Selected register (ILI9320_NO_INDEX - unknown)
+static ILI9320_RegStats regStats;   ///< Counters of issued and skipped writes
+
+/**
+ * @brief Nominal frame rates (Hz) selected by the FRS bits
+ * of the frame rate register.
+ */
+static const uint8_t frameRates[16] = {
+    40, 43, 45, 48, 51, 55, 59, 64, 70, 77, 85, 96, 110, 128, 128, 128
+};
+static uint32_t framePeriod;          ///< Duration of a frame (HAL ticks)
+static volatile uint32_t markTime;    ///< Start of frame markFrame (HAL ticks)
+static volatile uint32_t markFrame;   ///< Number of a frame with known start
+static volatile uint8_t markCount;    ///< FMARK pulses received (up to 2)
+static uint8_t markInterval;          ///< Frames between FMARK pulses (0 - no FMARK)
+static uint32_t pacedFrame;           ///< Frame returned by ILI9320_WaitFrame()
 
 /**
  * @brief Initialize the ILI9320 TFT LCD driver.
@@ -92,6 +182,7 @@ uint16_t ILI9320_RGBDecode(uint8_t r, uint8_t g, uint8_t b);
 void ILI9320_Initializtion(void) {
 
   ILI9320_HAL_HardInit(); // GPIO and FSMC init
+  ILI9320_InvalidateShadow();
 
   // Reset the LCD
   ILI9320_HAL_ResetOff();
@@ -101,73 +192,162 @@ void ILI9320_Initializtion(void) {
   ILI9320_HAL_ResetOff();
   TIMER_Delay(50);
 
-  ILI9320_HAL_WriteReg(ILI9320_START_OSCILLATION, 0x0001);
+  ILI9320_WriteReg(ILI9320_START_OSCILLATION, 0x0001);
   TIMER_Delay(20);
 
   // Read LCD ID
   unsigned int id;
   id = ILI9320_HAL_ReadReg(ILI9320_READ_ID);
+  indexReg = ILI9320_READ_ID;
 
   printf("ID TFT LCD = %x\r\n", id);
 
   // Add more LCD init codes here
   if (id == 0x9320) {
 
-    ILI9320_HAL_WriteReg(ILI9320_DRIVER_OUTPUT, 0x0100); // SS = 1 - coordinates from left to right
-    ILI9320_HAL_WriteReg(ILI9320_DRIVING_WAVE, 0x0700);  // Line inversion
-    ILI9320_HAL_WriteReg(ILI9320_ENTRY_MODE, 0x1018);    //
-    ILI9320_HAL_WriteReg(ILI9320_RESIZE, 0x0000);
-    ILI9320_HAL_WriteReg(ILI9320_DISP1, 0x0000);
-    ILI9320_HAL_WriteReg(ILI9320_DISP2, 0x0202); // two lines back porch, two line front porch
-    ILI9320_HAL_WriteReg(ILI9320_DISP3, 0x0000);
-    ILI9320_HAL_WriteReg(ILI9320_DISP4, 0x0000);
-    ILI9320_HAL_WriteReg(ILI9320_RGB_DISP1, 0x0001);
-    ILI9320_HAL_WriteReg(ILI9320_FRAME_MARKER, 0x0000); // 0th line for frame marker
-    ILI9320_HAL_WriteReg(ILI9320_RGB_DISP2, 0x0000);
-    ILI9320_HAL_WriteReg(ILI9320_DISP1, 0x0101);
-    ILI9320_HAL_WriteReg(ILI9320_POWER1, 0x10c0);
-    ILI9320_HAL_WriteReg(ILI9320_POWER2, 0x0007);
-    ILI9320_HAL_WriteReg(ILI9320_POWER3, 0x0110);
-    ILI9320_HAL_WriteReg(ILI9320_POWER4, 0x0b00);
-    ILI9320_HAL_WriteReg(ILI9320_POWER7, 0x0000);
-    ILI9320_HAL_WriteReg(ILI9320_FRAME_RATE, 0x4010);
+    ILI9320_WriteReg(ILI9320_DRIVER_OUTPUT, 0x0100); // SS = 1 - coordinates from left to right
+    ILI9320_WriteReg(ILI9320_DRIVING_WAVE, 0x0700);  // Line inversion
+    ILI9320_WriteReg(ILI9320_ENTRY_MODE, ILI9320_ENTRY_MODE_INIT); // row by row
+    ILI9320_WriteReg(ILI9320_RESIZE, 0x0000);
+    ILI9320_WriteReg(ILI9320_DISP1, 0x0000);
+    ILI9320_WriteReg(ILI9320_DISP2, 0x0202); // two lines back porch, two line front porch
+    ILI9320_WriteReg(ILI9320_DISP3, 0x0000);
+    ILI9320_WriteReg(ILI9320_DISP4, 0x0000);
+    ILI9320_WriteReg(ILI9320_RGB_DISP1, 0x0001);
+    ILI9320_WriteReg(ILI9320_FRAME_MARKER, 0x0000); // 0th line for frame marker
+    ILI9320_WriteReg(ILI9320_RGB_DISP2, 0x0000);
+    ILI9320_WriteReg(ILI9320_DISP1, 0x0101);
+    ILI9320_WriteReg(ILI9320_POWER1, 0x10c0);
+    ILI9320_WriteReg(ILI9320_POWER2, 0x0007);
+    ILI9320_WriteReg(ILI9320_POWER3, 0x0110);
+    ILI9320_WriteReg(ILI9320_POWER4, 0x0b00);
+    ILI9320_WriteReg(ILI9320_POWER7, 0x0000);
+    ILI9320_WriteReg(ILI9320_FRAME_RATE, ILI9320_FRAME_RATE_INIT);
 
     // Set window
-    ILI9320_HAL_WriteReg(ILI9320_HOR_ADDR_START, 0);
-    ILI9320_HAL_WriteReg(ILI9320_HOR_ADDR_END, 239);
-    ILI9320_HAL_WriteReg(ILI9320_VER_ADDR_START, 0);
-    ILI9320_HAL_WriteReg(ILI9320_VER_ADDR_END, 319);
-
-    ILI9320_HAL_WriteReg(ILI9320_DRIVER_OUTPUT2, 0x2700);
-    ILI9320_HAL_WriteReg(ILI9320_BASE_IMAGE, 0x0001);
-    ILI9320_HAL_WriteReg(ILI9320_VERTICAL_SCROLL, 0x0000);
-    ILI9320_HAL_WriteReg(ILI9320_PARTIAL1_POS, 0x0000);
-    ILI9320_HAL_WriteReg(ILI9320_PARTIAL1_START, 0x0000);
-    ILI9320_HAL_WriteReg(ILI9320_PARTIAL1_END, 0x0000);
-    ILI9320_HAL_WriteReg(ILI9320_PARTIAL2_POS, 0x0000);
-    ILI9320_HAL_WriteReg(ILI9320_PARTIAL2_START, 0x0000);
-    ILI9320_HAL_WriteReg(ILI9320_PARTIAL2_END, 0x0000);
-    ILI9320_HAL_WriteReg(ILI9320_PANEL_INTERFACE1, 0x0010);
-    ILI9320_HAL_WriteReg(ILI9320_PANEL_INTERFACE2, 0x0000);
-    ILI9320_HAL_WriteReg(ILI9320_PANEL_INTERFACE3, 0x0001);
-    ILI9320_HAL_WriteReg(ILI9320_PANEL_INTERFACE4, 0x0110);
-    ILI9320_HAL_WriteReg(ILI9320_PANEL_INTERFACE5, 0x0000);
-    ILI9320_HAL_WriteReg(ILI9320_PANEL_INTERFACE6, 0x0000);
-    ILI9320_HAL_WriteReg(ILI9320_DISP1, 0x0173);
+    ILI9320_WriteReg(ILI9320_HOR_ADDR_START, 0);
+    ILI9320_WriteReg(ILI9320_HOR_ADDR_END, 239);
+    ILI9320_WriteReg(ILI9320_VER_ADDR_START, 0);
+    ILI9320_WriteReg(ILI9320_VER_ADDR_END, 319);
+
+    ILI9320_WriteReg(ILI9320_DRIVER_OUTPUT2, 0x2700);
+    // scrolling is enabled once, so scrolling is a single write of 0x6A
+    ILI9320_WriteReg(ILI9320_BASE_IMAGE,
+        ILI9320_BASE_IMAGE_VLE | ILI9320_BASE_IMAGE_REV);
+    ILI9320_WriteReg(ILI9320_VERTICAL_SCROLL, 0x0000);
+    scrollOffset = 0;
+    ILI9320_WriteReg(ILI9320_PARTIAL1_POS, 0x0000);
+    ILI9320_WriteReg(ILI9320_PARTIAL1_START, 0x0000);
+    ILI9320_WriteReg(ILI9320_PARTIAL1_END, 0x0000);
+    ILI9320_WriteReg(ILI9320_PARTIAL2_POS, 0x0000);
+    ILI9320_WriteReg(ILI9320_PARTIAL2_START, 0x0000);
+    ILI9320_WriteReg(ILI9320_PARTIAL2_END, 0x0000);
+    ILI9320_WriteReg(ILI9320_PANEL_INTERFACE1, 0x0010);
+    ILI9320_WriteReg(ILI9320_PANEL_INTERFACE2, 0x0000);
+    ILI9320_WriteReg(ILI9320_PANEL_INTERFACE3, 0x0001);
+    ILI9320_WriteReg(ILI9320_PANEL_INTERFACE4, 0x0110);
+    ILI9320_WriteReg(ILI9320_PANEL_INTERFACE5, 0x0000);
+    ILI9320_WriteReg(ILI9320_PANEL_INTERFACE6, 0x0000);
+    ILI9320_WriteReg(ILI9320_DISP1, 0x0173);
 
+    ILI9320_CalibrateTiming();
   }
 
+  // frames are predicted with the nominal rate until FMARK is used
+  framePeriod = ILI9320_HAL_TickFreq() /
+      frameRates[ILI9320_FRAME_RATE_INIT & ILI9320_FRAME_RATE_FRS];
+  markTime = ILI9320_HAL_GetTicks();
+  markFrame = 0;
+  markCount = 0;
+  markInterval = 0;
+  pacedFrame = 0;
+
   TIMER_Delay(100);
 }
+/**
+ * @brief Finds the fastest write timing accepted by the LCD.
+ *
+ * @details The FSMC runs in extended mode, with separate read and
+ * write timings. Reads keep the safe timing set by the HAL, while the
+ * write timing is lowered step by step: a test pattern (solid,
+ * alternating and walking bits, pseudo random) is written to the
+ * first two lines of the GRAM and compared with the same pattern
+ * written to the next two lines at the safe timing. The pattern is
+ * generated while it is written, so the test needs little stack.
+ * The fastest timing which passes every test gets one cycle
+ * of margin on both the address and the data setup time.
+ * The speed of a full screen fill is then measured.
+ *
+ * The function is called by ILI9320_Initializtion() and leaves
+ * the tested area black.
+ *
+ * @return Write speed in pixels per second.
+ */
+uint32_t ILI9320_CalibrateTiming(void) {
+
+  uint8_t bestAddress = ILI9320_HAL_ADDRESS_SETUP;
+  uint8_t bestData = ILI9320_HAL_DATA_SETUP;
+  uint32_t start, ticks, rate;
+  int address, data;
+
+  // the LCD may store colors differently (BGR), so the pattern
+  // written at the safe timing is the reference
+  ILI9320_HAL_SetWriteTiming(ILI9320_HAL_ADDRESS_SETUP, ILI9320_HAL_DATA_SETUP);
+  ILI9320_WriteBegin(2, 0, 2, ILI9320_HEIGHT);
+  ILI9320_WritePattern();
+  ILI9320_WriteEnd();
+
+  for (data = ILI9320_HAL_DATA_SETUP; data > 0; data--) {
+    // the slowest address setup has to work, otherwise
+    // shorter data setup times will not work either
+    if (ILI9320_TestTiming(ILI9320_HAL_ADDRESS_SETUP, data)) {
+      break;
+    }
+    for (address = ILI9320_HAL_ADDRESS_SETUP; address > 0; address--) {
+      if (ILI9320_TestTiming(address - 1, data)) {
+        break;
+      }
+    }
+    if (address + data < bestAddress + bestData) {
+      bestAddress = address;
+      bestData = data;
+    }
+  }
+
+  if (bestAddress < ILI9320_HAL_ADDRESS_SETUP) {
+    bestAddress++;
+  }
+  if (bestData < ILI9320_HAL_DATA_SETUP) {
+    bestData++;
+  }
+  ILI9320_HAL_SetWriteTiming(bestAddress, bestData);
+
+  ILI9320_WriteBegin(0, 0, ILI9320_WIDTH, ILI9320_HEIGHT);
+  start = ILI9320_HAL_GetTicks();
+  ILI9320_WriteFill(0x0000, (uint32_t)ILI9320_WIDTH * ILI9320_HEIGHT);
+  ticks = ILI9320_HAL_GetTicks() - start;
+  ILI9320_WriteEnd();
+
+  rate = (uint64_t)ILI9320_WIDTH * ILI9320_HEIGHT *
+      ILI9320_HAL_TickFreq() / (ticks ? ticks : 1);
+
+  printf("LCD write timing = %u/%u, %lu pixels/s\r\n",
+      bestAddress, bestData, (unsigned long)rate);
+
+  return rate;
+}
 /**
  * @brief Convert RGB value to ILI9320 format.
- * @param r Red
- * @param g Green
- * @param b Blue
- * @return Converted value of color.
+ *
+ * @details The highest 5/6/5 bits of the components are taken.
+ *
+ * @param r Red (8 bits)
+ * @param g Green (8 bits)
+ * @param b Blue (8 bits)
+ * @return Converted value of color (RGB565).
  */
 uint16_t ILI9320_RGBDecode(uint8_t r, uint8_t g, uint8_t b) {
-  return ((r & 0x1f) << 11) | ((g & 0x3f) << 5) | (b & 0x1f);
+  return ((r & 0xf8) << 8) | ((g & 0xfc) << 3) | (b >> 3);
 }
 /**
  * @brief Move cursor to given coordinates.
@@ -176,8 +356,8 @@ uint16_t ILI9320_RGBDecode(uint8_t r, uint8_t g, uint8_t b) {
  */
 void ILI9320_SetCursor(uint16_t x, uint16_t y) {
 
-  ILI9320_HAL_WriteReg(ILI9320_HOR_GRAM_ADDR, y);
-  ILI9320_HAL_WriteReg(ILI9320_VER_GRAM_ADDR, x);
+  ILI9320_WriteReg(ILI9320_HOR_GRAM_ADDR, y);
+  ILI9320_WriteReg(ILI9320_VER_GRAM_ADDR, ILI9320_PhysX(x));
 
 }
 /**
@@ -190,11 +370,41 @@ void ILI9320_SetCursor(uint16_t x, uint16_t y) {
  */
 void ILI9320_DrawPixel(uint16_t x, uint16_t y, uint8_t r, uint8_t g, uint8_t b) {
 
+  ILI9320_DrawPixelColor(x, y, ILI9320_RGBDecode(r, g, b));
+}
+/**
+ * @brief Draws a pixel of an already converted color on the LCD.
+ * @param x X coordinate of pixel.
+ * @param y Y coordinate of pixel.
+ * @param color Pixel color (RGB565).
+ */
+void ILI9320_DrawPixelColor(uint16_t x, uint16_t y, uint16_t color) {
+
+  const uint16_t px = ILI9320_PhysX(x);
+
+  if (windowActive) {
+    ILI9320_RestoreWindow();
+  }
   ILI9320_SetCursor(x, y);
-  ILI9320_HAL_WriteReg(ILI9320_WRITE_TO_GRAM, ILI9320_RGBDecode(r, g, b));
+  ILI9320_SelectGRAM();
+  ILI9320_HAL_WriteData(color);
+
+  // the address counter moved to the next line of the full
+  // screen window, so the next pixel there needs no cursor write
+  if (px < ILI9320_WIDTH - 1) {
+    ILI9320_SetShadow(ILI9320_HOR_GRAM_ADDR, y);
+    ILI9320_SetShadow(ILI9320_VER_GRAM_ADDR, px + 1);
+  }
 }
 /**
  * @brief Set work window to draw data.
+ *
+ * @details The window must not cross the line returned by
+ * ILI9320_GetScrollSeam() - such windows have to be split by the
+ * caller. A full width window is not moved by scrolling, so its rows
+ * are taken in GRAM order (starting from the line returned by
+ * ILI9320_GetScrollSeam()).
+ *
  * @param x X coordinate of start point.
  * @param y Y coordinate of start point.
  * @param width Width of window.
@@ -202,11 +412,698 @@ void ILI9320_DrawPixel(uint16_t x, uint16_t y, uint8_t r, uint8_t g, uint8_t b)
  */
 void ILI9320_SetWindow(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
 
-  ILI9320_SetCursor(x, y);
-  ILI9320_HAL_WriteReg(ILI9320_HOR_ADDR_START, y);
-  ILI9320_HAL_WriteReg(ILI9320_HOR_ADDR_END, y + height - 1);
-  ILI9320_HAL_WriteReg(ILI9320_VER_ADDR_START, x);
-  ILI9320_HAL_WriteReg(ILI9320_VER_ADDR_END, x + width - 1);
+  const uint16_t px = (width >= ILI9320_WIDTH) ? x : ILI9320_PhysX(x);
+
+  ILI9320_WriteReg(ILI9320_HOR_GRAM_ADDR, y);
+  ILI9320_WriteReg(ILI9320_VER_GRAM_ADDR, px);
+  ILI9320_WriteReg(ILI9320_HOR_ADDR_START, y);
+  ILI9320_WriteReg(ILI9320_HOR_ADDR_END, y + height - 1);
+  ILI9320_WriteReg(ILI9320_VER_ADDR_START, px);
+  ILI9320_WriteReg(ILI9320_VER_ADDR_END, px + width - 1);
+
+  windowActive = (x != 0 || y != 0 ||
+      width != ILI9320_WIDTH || height != ILI9320_HEIGHT);
+}
+/**
+ * @brief Scrolls the screen along the X axis.
+ *
+ * @details Sets the GRAM line shown as the first line of the screen.
+ * Logical coordinates follow the contents, so after scrolling by n
+ * lines an object drawn at X is seen at X - n.
+ *
+ * @param lines Scroll amount (0 to ILI9320_WIDTH-1)
+ */
+void ILI9320_SetScroll(uint16_t lines) {
+
+  scrollOffset = lines % ILI9320_WIDTH;
+  ILI9320_WriteReg(ILI9320_VERTICAL_SCROLL, scrollOffset);
+}
+/**
+ * @brief Returns the current scroll amount.
+ * @return GRAM line shown as the first line of the screen.
+ */
+uint16_t ILI9320_GetScroll(void) {
+
+  return scrollOffset;
+}
+/**
+ * @brief Returns the logical X coordinate placed at the first GRAM line.
+ *
+ * @details Windows can not wrap around the end of the GRAM, so windows
+ * crossing this line have to be split.
+ *
+ * @return X coordinate of the seam, 0 if the screen is not scrolled.
+ */
+uint16_t ILI9320_GetScrollSeam(void) {
+
+  return scrollOffset ? ILI9320_WIDTH - scrollOffset : 0;
+}
+/**
+ * @brief Sets up a partial image.
+ *
+ * @details A partial image shows GRAM lines start to end on the
+ * screen from line pos on. It is not moved by scrolling and is shown
+ * only with the base image turned off (see ILI9320_EnablePartialImage()). Line numbers are GRAM lines (X coordinates
+ * on a screen which is not scrolled).
+ *
+ * @param image Partial image (0 or 1)
+ * @param pos First line of the screen showing the image
+ * @param start First GRAM line of the image
+ * @param end Last GRAM line of the image
+ */
+void ILI9320_SetPartialImage(uint8_t image, uint16_t pos,
+    uint16_t start, uint16_t end) {
+
+  if (image == 0) {
+    ILI9320_WriteReg(ILI9320_PARTIAL1_POS, pos);
+    ILI9320_WriteReg(ILI9320_PARTIAL1_START, start);
+    ILI9320_WriteReg(ILI9320_PARTIAL1_END, end);
+  } else {
+    ILI9320_WriteReg(ILI9320_PARTIAL2_POS, pos);
+    ILI9320_WriteReg(ILI9320_PARTIAL2_START, start);
+    ILI9320_WriteReg(ILI9320_PARTIAL2_END, end);
+  }
+}
+/**
+ * @brief Shows or hides a partial image.
+ *
+ * @details The controller shows partial images only when the base
+ * image is turned off, so the base image is hidden while any partial
+ * image is shown - lines outside of partial images show the
+ * non-display level. It is shown again when both are hidden.
+ *
+ * @param image Partial image (0 or 1)
+ * @param enable 1 - show image, 0 - hide image
+ */
+void ILI9320_EnablePartialImage(uint8_t image, uint8_t enable) {
+
+  const uint16_t bit = image ? ILI9320_DISP1_PTDE1 : ILI9320_DISP1_PTDE0;
+  uint16_t disp1 = regShadow[ILI9320_DISP1];
+
+  if (enable) {
+    disp1 |= bit;
+  } else {
+    disp1 &= ~bit;
+  }
+
+  if (disp1 & (ILI9320_DISP1_PTDE0 | ILI9320_DISP1_PTDE1)) {
+    disp1 &= ~ILI9320_DISP1_BASEE;
+  } else {
+    disp1 |= ILI9320_DISP1_BASEE;
+  }
+  ILI9320_WriteReg(ILI9320_DISP1, disp1);
+}
+/**
+ * @brief Converts a logical X coordinate to a GRAM line.
+ * @param x Logical X coordinate
+ * @return GRAM line (vertical GRAM address)
+ */
+static uint16_t ILI9320_PhysX(uint16_t x) {
+
+  // coordinates outside of the screen are left as they are
+  if (x >= ILI9320_WIDTH) {
+    return x;
+  }
+
+  x += scrollOffset;
+  if (x >= ILI9320_WIDTH) {
+    x -= ILI9320_WIDTH;
+  }
+  return x;
+}
+/**
+ * @brief Synchronizes the driver to the frame marker (FMARK) of the LCD.
+ *
+ * @details The LCD pulses FMARK when it starts scanning a frame
+ * (from the first line of the back porch). The pulses give the
+ * position of the scan line, which is predicted with the core cycle
+ * counter in between, and the measured frame period. With an
+ * interval longer than one frame there are fewer interrupts, and the
+ * prediction only has to last a few frames. The function waits for
+ * the first pulse.
+ *
+ * @param interval Frames between FMARK pulses (1, 2, 4 or 6),
+ * 0 turns FMARK off.
+ * @retval 0 Synchronized to FMARK
+ * @retval -1 Wrong interval or no FMARK pulse (not connected)
+ */
+int ILI9320_VsyncInit(uint8_t interval) {
+
+  uint16_t fmi;
+  uint32_t start;
+
+  switch (interval) {
+  case 1: fmi = 0x0000; break;
+  case 2: fmi = 0x0001; break;
+  case 4: fmi = 0x0003; break;
+  case 6: fmi = 0x0005; break;
+  default:
+    markInterval = 0;
+    ILI9320_WriteReg(ILI9320_DISP4, 0x0000);
+    return interval ? -1 : 0;
+  }
+
+  markCount = 0;
+  markInterval = interval;
+  ILI9320_WriteReg(ILI9320_FRAME_MARKER, 0x0000);
+  ILI9320_WriteReg(ILI9320_DISP4, ILI9320_DISP4_FMARKOE | fmi);
+  ILI9320_HAL_FmarkInit(ILI9320_FmarkCallback);
+
+  // the first pulse comes within interval frames
+  start = ILI9320_HAL_GetTicks();
+  while (markCount == 0) {
+    if (ILI9320_HAL_GetTicks() - start > 2 * interval * framePeriod) {
+      markInterval = 0;
+      ILI9320_WriteReg(ILI9320_DISP4, 0x0000);
+      return -1;
+    }
+  }
+
+  return 0;
+}
+/**
+ * @brief Returns the duration of a frame.
+ *
+ * @details The period is measured when FMARK is used, otherwise
+ * it is the nominal period set by the frame rate register.
+ *
+ * @return Frame period in microseconds.
+ */
+uint32_t ILI9320_GetFramePeriod(void) {
+
+  return (uint64_t)framePeriod * 1000000 / ILI9320_HAL_TickFreq();
+}
+/**
+ * @brief Returns the number of the frame being scanned.
+ * @return Frame number.
+ */
+uint32_t ILI9320_GetFrame(void) {
+
+  uint32_t frame;
+
+  ILI9320_ScanPosition(&frame);
+  return frame;
+}
+/**
+ * @brief Returns the line being scanned by the LCD.
+ * @return X coordinate of scanned line, ILI9320_WIDTH in porches,
+ * -1 if the driver is not synchronized to FMARK.
+ */
+int ILI9320_GetScanLine(void) {
+
+  uint32_t frame;
+  const int line = (int)ILI9320_ScanPosition(&frame) - ILI9320_BACK_PORCH;
+
+  if (markInterval == 0) {
+    return -1;
+  }
+  return (line >= 0 && line < ILI9320_WIDTH) ? line : ILI9320_WIDTH;
+}
+/**
+ * @brief Waits until an area can be rewritten without tearing.
+ *
+ * @details Writes progress along the Y axis, while the LCD scans
+ * along the X axis, so an area is torn if the scan passes it while
+ * it is written. The function returns when the scan line has just
+ * left the lines x to x + width - 1, so the area is behind the scan
+ * and more than half of the remaining frame is left before the scan
+ * reaches it again. Large areas should be sent in pieces of
+ * ILI9320_VSYNC_LINES lines from left to right - every piece is
+ * then written right behind the scan line.
+ *
+ * Without FMARK synchronization the function returns at once.
+ *
+ * @param x X coordinate of area
+ * @param width Width of area
+ */
+void ILI9320_WaitScanOutside(uint16_t x, uint16_t width) {
+
+  uint32_t frame;
+  const uint32_t end = ILI9320_BACK_PORCH + x + width;
+  const uint32_t slack = (ILI9320_FRAME_LINES - width) / 2;
+
+  if (markInterval == 0 || width >= ILI9320_WIDTH) {
+    return;
+  }
+
+  // distance of the scan line past the end of the area
+  while ((ILI9320_ScanPosition(&frame) + ILI9320_FRAME_LINES - end)
+      % ILI9320_FRAME_LINES >= slack);
+}
+/**
+ * @brief Paces an animation to the frame rate of the LCD.
+ *
+ * @details Waits for the start of the frame which comes the given
+ * number of frames after the frame returned by the previous call, so
+ * an animation runs at the frame rate divided by frames. If that frame
+ * has already started, the function waits for the next one and the
+ * missed frames are returned.
+ *
+ * @param frames Frames between animation steps
+ * @return Number of dropped frames.
+ */
+uint32_t ILI9320_WaitFrame(uint8_t frames) {
+
+  uint32_t frame;
+  uint32_t target = pacedFrame + frames;
+  uint32_t dropped = 0;
+
+  ILI9320_ScanPosition(&frame);
+
+  if ((int32_t)(frame - target) >= 0) {
+    dropped = frame + 1 - target;
+    target = frame + 1;
+  }
+
+  do {
+    ILI9320_ScanPosition(&frame);
+  } while ((int32_t)(frame - target) < 0);
+
+  pacedFrame = target;
+  return dropped;
+}
+/**
+ * @brief Reads the counters of register writes.
+ * @param s Structure to fill.
+ */
+void ILI9320_GetRegStats(ILI9320_RegStats* s) {
+
+  *s = regStats;
+}
+/**
+ * @brief Clears the counters of register writes.
+ */
+void ILI9320_ResetRegStats(void) {
+
+  memset(&regStats, 0, sizeof(regStats));
+}
+/**
+ * @brief Writes a register unless it already holds the value.
+ * @param reg Register address.
+ * @param data Data to write.
+ */
+static void ILI9320_WriteReg(uint16_t reg, uint16_t data) {
+
+  const uint32_t mask = 1UL << (reg & 31);
+
+  if ((regValid[reg >> 5] & mask) && regShadow[reg] == data) {
+    regStats.regElided++;
+    return;
+  }
+
+  ILI9320_WriteIndex(reg);
+  ILI9320_HAL_WriteData(data);
+  regStats.regIssued++;
+
+  ILI9320_SetShadow(reg, data);
+}
+/**
+ * @brief Selects a register unless it is already selected.
+ * @param reg Register address.
+ */
+static void ILI9320_WriteIndex(uint16_t reg) {
+
+  if (indexReg == reg) {
+    regStats.indexElided++;
+    return;
+  }
+
+  ILI9320_HAL_WriteIndex(reg);
+  regStats.indexIssued++;
+  indexReg = reg;
+}
+/**
+ * @brief Selects the GRAM for writing pixels.
+ *
+ * @details The pixels move the address counter, so the cursor
+ * registers have to be written again before the next access.
+ */
+static void ILI9320_SelectGRAM(void) {
+
+  ILI9320_WriteIndex(ILI9320_WRITE_TO_GRAM);
+  regValid[ILI9320_HOR_GRAM_ADDR >> 5] &= ~(1UL << (ILI9320_HOR_GRAM_ADDR & 31));
+  regValid[ILI9320_VER_GRAM_ADDR >> 5] &= ~(1UL << (ILI9320_VER_GRAM_ADDR & 31));
+}
+/**
+ * @brief Records the contents of a register.
+ * @param reg Register address.
+ * @param data Value held by the register.
+ */
+static void ILI9320_SetShadow(uint16_t reg, uint16_t data) {
+
+  regShadow[reg] = data;
+  regValid[reg >> 5] |= 1UL << (reg & 31);
+}
+/**
+ * @brief Handles an FMARK pulse.
+ *
+ * @details The frame period is measured between pulses. Periods far
+ * from the current one (missed pulses) are ignored.
+ */
+static void ILI9320_FmarkCallback(void) {
+
+  const uint32_t now = ILI9320_HAL_GetTicks();
+  const uint32_t period = (now - markTime) / markInterval;
+
+  if (markCount) {
+    if (period > framePeriod - framePeriod / 4 &&
+        period < framePeriod + framePeriod / 4) {
+      framePeriod = (framePeriod * 3 + period) / 4;
+    }
+    markFrame += markInterval;
+  } else {
+    markFrame = ILI9320_GetFrame() + 1;
+  }
+
+  markTime = now;
+  if (markCount < 2) {
+    markCount++;
+  }
+}
+/**
+ * @brief Predicts the position of the scan.
+ * @param frame Number of the frame being scanned.
+ * @return Line being scanned (0 - first line of back porch).
+ */
+static uint32_t ILI9320_ScanPosition(uint32_t* frame) {
+
+  uint32_t time, first, elapsed;
+
+  // FMARK may update the reference in between
+  do {
+    time = markTime;
+    first = markFrame;
+  } while (time != markTime);
+
+  elapsed = ILI9320_HAL_GetTicks() - time;
+
+  // without FMARK the reference is moved forward, so that
+  // the elapsed time does not overflow
+  if (markInterval == 0 && elapsed >= framePeriod) {
+    markFrame = first += elapsed / framePeriod;
+    markTime = time += elapsed / framePeriod * framePeriod;
+    elapsed -= elapsed / framePeriod * framePeriod;
+  }
+
+  *frame = first + elapsed / framePeriod;
+
+  return (uint64_t)(elapsed % framePeriod) * ILI9320_FRAME_LINES / framePeriod;
+}
+/**
+ * @brief Checks if the LCD accepts a write timing.
+ *
+ * @details The area is cleared at the safe timing, so a write which
+ * is lost is not hidden by the previous pass. Only GRAM data is
+ * written at the tested timing. The tested lines are read back
+ * together with the reference lines next to them, a few rows at
+ * a time.
+ *
+ * @param addressSetup Address setup time (HCLK cycles)
+ * @param dataSetup Data setup time (HCLK cycles)
+ * @retval 0 Timing works
+ * @retval -1 Data read back differs
+ */
+static int ILI9320_TestTiming(uint8_t addressSetup, uint8_t dataSetup) {
+
+  uint16_t buf[ILI9320_CALIB_ROWS * 4];
+
+  for (int pass = 0; pass < ILI9320_CALIB_REPEAT; pass++) {
+
+    ILI9320_WriteBegin(0, 0, 2, ILI9320_HEIGHT);
+    ILI9320_WriteFill(pass & 1 ? 0xffff : 0x0000, ILI9320_CALIB_PIXELS);
+
+    ILI9320_WriteBegin(0, 0, 2, ILI9320_HEIGHT);
+    ILI9320_HAL_SetWriteTiming(addressSetup, dataSetup);
+    ILI9320_WritePattern();
+    ILI9320_HAL_SetWriteTiming(ILI9320_HAL_ADDRESS_SETUP,
+        ILI9320_HAL_DATA_SETUP);
+    ILI9320_WriteEnd();
+
+    // every row holds two tested and two reference pixels
+    for (int y = 0; y < ILI9320_HEIGHT; y += ILI9320_CALIB_ROWS) {
+      ILI9320_ReadWindow(0, y, 4, ILI9320_CALIB_ROWS, buf, 4);
+      for (int i = 0; i < ILI9320_CALIB_ROWS * 4; i += 4) {
+        if (buf[i] != buf[i + 2] || buf[i + 1] != buf[i + 3]) {
+          return -1;
+        }
+      }
+    }
+  }
+
+  return 0;
+}
+/**
+ * @brief Writes the timing test pattern to an opened burst.
+ *
+ * @details Solid, alternating and walking bits, then pseudo random
+ * pixels - ILI9320_CALIB_PIXELS in total. The pattern is generated
+ * 16 pixels at a time, which are written back to back.
+ */
+static void ILI9320_WritePattern(void) {
+
+  uint16_t chunk[16];
+  uint16_t lfsr = 0xace1;
+
+  for (int i = 0; i < ILI9320_CALIB_PIXELS; i += 16) {
+    for (int j = 0; j < 16; j++) {
+      switch (i / 16) {
+      case 0: chunk[j] = 0x0000; break;
+      case 1: chunk[j] = 0xffff; break;
+      case 2: chunk[j] = (j & 1) ? 0xaaaa : 0x5555; break;
+      case 3: chunk[j] = 1 << j; break;
+      case 4: chunk[j] = ~(1 << j); break;
+      default:
+        // Galois LFSR, x^16 + x^14 + x^13 + x^11 + 1
+        lfsr = (lfsr >> 1) ^ (-(lfsr & 1) & 0xb400);
+        chunk[j] = lfsr;
+        break;
+      }
+    }
+    ILI9320_WritePixels(chunk, 16);
+  }
+}
+/**
+ * @brief Forgets the contents of all registers (after reset).
+ */
+static void ILI9320_InvalidateShadow(void) {
+
+  memset(regValid, 0, sizeof(regValid));
+  indexReg = ILI9320_NO_INDEX;
+}
+/**
+ * @brief Restores the full screen work window.
+ */
+static void ILI9320_RestoreWindow(void) {
+
+  ILI9320_SetWindow(0, 0, ILI9320_WIDTH, ILI9320_HEIGHT);
+}
+/**
+ * @brief Starts a burst write to a window.
+ *
+ * @details The window and cursor are set once and the GRAM register
+ * is selected once, so every following pixel costs a single bus cycle.
+ * Pixels are expected row by row - X increments first, then Y.
+ * After writing all data ILI9320_WriteEnd() should be called.
+ * A single row is written in the full screen window, if it is set,
+ * with just the cursor, so short runs of pixels are cheap.
+ *
+ * @param x X coordinate of start point.
+ * @param y Y coordinate of start point.
+ * @param width Width of window.
+ * @param height Height of window.
+ */
+void ILI9320_WriteBegin(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
+
+  const uint16_t px = ILI9320_PhysX(x);
+
+  // the address counter moves along the X axis first, so a part of
+  // a row of the full screen window needs only the cursor
+  if (height == 1 && !windowActive && px + width <= ILI9320_WIDTH) {
+    ILI9320_SetCursor(x, y);
+    ILI9320_SelectGRAM();
+    // where the counter stops after the row
+    if (px + width < ILI9320_WIDTH) {
+      ILI9320_SetShadow(ILI9320_HOR_GRAM_ADDR, y);
+      ILI9320_SetShadow(ILI9320_VER_GRAM_ADDR, px + width);
+    }
+    return;
+  }
+
+  ILI9320_SetWindow(x, y, width, height);
+  ILI9320_SelectGRAM();
+}
+/**
+ * @brief Starts a burst write to a window filled from the bottom row up.
+ *
+ * @details Same as ILI9320_WriteBegin(), but Y is decremented after
+ * every row, so pixels are expected row by row starting with the bottom
+ * row (each row still from left to right) - the order of rows in most
+ * BMP files. ILI9320_WriteEnd() restores the normal direction.
+ *
+ * @param x X coordinate of start point.
+ * @param y Y coordinate of start point.
+ * @param width Width of window.
+ * @param height Height of window.
+ */
+void ILI9320_WriteBeginBottomUp(uint16_t x, uint16_t y, uint16_t width,
+    uint16_t height) {
+
+  ILI9320_SetWindow(x, y, width, height);
+  ILI9320_WriteReg(ILI9320_ENTRY_MODE,
+      ILI9320_ENTRY_MODE_INIT & ~ILI9320_ENTRY_MODE_ID0);
+  ILI9320_WriteReg(ILI9320_HOR_GRAM_ADDR, y + height - 1);
+  ILI9320_SelectGRAM();
+  bottomUp = 1;
+}
+/**
+ * @brief Writes one pixel of an opened burst.
+ * @param color Pixel color (RGB565).
+ */
+void ILI9320_WritePush(uint16_t color) {
+
+  ILI9320_HAL_WriteData(color);
+}
+/**
+ * @brief Writes a buffer of pixels of an opened burst.
+ * @param buf Pixel colors (RGB565).
+ * @param n Number of pixels.
+ */
+void ILI9320_WritePixels(const uint16_t* buf, uint32_t n) {
+
+  ILI9320_HAL_WriteDataBuffer(buf, n);
+}
+/**
+ * @brief Writes n pixels of the same color in an opened burst.
+ * @param color Pixel color (RGB565).
+ * @param n Number of pixels.
+ */
+void ILI9320_WriteFill(uint16_t color, uint32_t n) {
+
+  ILI9320_HAL_FillData(color, n);
+}
+/**
+ * @brief Writes a buffer of pixels of an opened burst using DMA.
+ *
+ * @details Returns immediately. Any following access to the LCD
+ * waits for the transfer to finish, so ILI9320_WriteEnd() may be
+ * called right away. The buffer has to stay valid until the
+ * callback is called or ILI9320_TransferBusy() returns 0.
+ *
+ * @param buf Pixel colors (RGB565).
+ * @param n Number of pixels.
+ * @param cb Function called after the transfer is complete (may be null).
+ */
+void ILI9320_WritePixelsAsync(const uint16_t* buf, uint32_t n, void (*cb)(void)) {
+
+  ILI9320_HAL_DMAWrite(buf, n, cb);
+}
+/**
+ * @brief Writes n pixels of the same color in an opened burst using DMA.
+ *
+ * @details Returns immediately, see ILI9320_WritePixelsAsync().
+ *
+ * @param color Pixel color (RGB565).
+ * @param n Number of pixels.
+ * @param cb Function called after the transfer is complete (may be null).
+ */
+void ILI9320_WriteFillAsync(uint16_t color, uint32_t n, void (*cb)(void)) {
+
+  ILI9320_HAL_DMAFill(color, n, cb);
+}
+/**
+ * @brief Checks if an asynchronous transfer is in progress.
+ * @retval 1 Transfer in progress
+ * @retval 0 LCD bus is free
+ */
+uint8_t ILI9320_TransferBusy(void) {
+
+  return ILI9320_HAL_DMABusy();
+}
+/**
+ * @brief Waits for the asynchronous transfer to finish.
+ */
+void ILI9320_WaitTransfer(void) {
+
+  while (ILI9320_HAL_DMABusy());
+}
+/**
+ * @brief Ends a burst write.
+ *
+ * @details The window is left as is - the full screen window is
+ * restored before the next single pixel write, so consecutive bursts
+ * do not pay for it.
+ */
+void ILI9320_WriteEnd(void) {
+
+  if (bottomUp) {
+    ILI9320_WriteReg(ILI9320_ENTRY_MODE, ILI9320_ENTRY_MODE_INIT);
+    bottomUp = 0;
+  }
+}
+/**
+ * @brief Reads pixels of a rectangle from the GRAM.
+ *
+ * @details Pixels are stored row by row, as ILI9320_WritePixels()
+ * expects them, so a rectangle can be read, modified (for example
+ * blended with a popup) and written back. The rectangle is read in a
+ * single window (two if it crosses the scroll seam), so reading costs
+ * one bus cycle per pixel and a dummy read per window.
+ *
+ * @param x X coordinate of start point.
+ * @param y Y coordinate of start point.
+ * @param width Width of rectangle.
+ * @param height Height of rectangle.
+ * @param buf Buffer for width * height pixels (RGB565).
+ */
+void ILI9320_ReadPixels(uint16_t x, uint16_t y, uint16_t width,
+    uint16_t height, uint16_t* buf) {
+
+  const uint16_t seam = ILI9320_GetScrollSeam();
+
+  if (x + width > ILI9320_WIDTH || y + height > ILI9320_HEIGHT) {
+    return;
+  }
+
+  // the parts left and right of the scroll seam are apart in GRAM
+  // (this also keeps a scrolled full width window mapped)
+  if (x < seam && seam < x + width) {
+    ILI9320_ReadWindow(x, y, seam - x, height, buf, width);
+    ILI9320_ReadWindow(seam, y, x + width - seam, height,
+        buf + seam - x, width);
+  } else {
+    ILI9320_ReadWindow(x, y, width, height, buf, width);
+  }
+}
+/**
+ * @brief Reads a window of the GRAM.
+ * @param x X coordinate of start point.
+ * @param y Y coordinate of start point.
+ * @param width Width of window.
+ * @param height Height of window.
+ * @param buf Buffer for the first pixel of the window.
+ * @param stride Distance between rows in the buffer (pixels).
+ */
+static void ILI9320_ReadWindow(uint16_t x, uint16_t y, uint16_t width,
+    uint16_t height, uint16_t* buf, uint16_t stride) {
+
+  uint16_t c;
+
+  ILI9320_SetWindow(x, y, width, height);
+  ILI9320_SelectGRAM();
+
+  // the first read after setting the cursor is a dummy read
+  ILI9320_HAL_ReadData();
+
+  for (int i = 0; i < height; i++, buf += stride) {
+    ILI9320_HAL_ReadDataBuffer(buf, width);
+
+    if (regShadow[ILI9320_ENTRY_MODE] & ILI9320_ENTRY_MODE_BGR) {
+      for (int j = 0; j < width; j++) {
+        c = buf[j];
+        buf[j] = (c << 11) | (c & 0x07e0) | (c >> 11);
+      }
+    }
+  }
 }
 
 /**
@@ -0,0 +1,882 @@
+/**
+ * @file    jpeg.c
+ * @brief   Baseline JPEG decoder.
+ * @date    16 paź 2026
+ * @author  agent
+ *
+ * @details Decodes baseline (and extended sequential, 8 bit) Huffman
+ * coded JPEG files, gray or YCbCr with sampling up to 2x2 (4:4:4,
+ * 4:2:2, 4:2:0). The file is read through a buffer of a single sector,
+ * so the image never has to fit in memory - MCUs are decoded one by one,
+ * converted to RGB565 and handed to an output function, which sends
+ * them to a window of the LCD (see GRAPH_DrawJpegFile()). Two MCU
+ * buffers let one MCU be sent by DMA while the next one is decoded.
+ * All the working memory (tables, buffers) is about 3.5 KB.
+ *
+ * The image can be scaled down by 2, 4 or 8 while it is decoded:
+ * the IDCT is computed only for the lowest 4x4 or 2x2 frequencies,
+ * and 1/8 images take just the DC value of each block.
+ *
+ * The IDCT multiplies the coefficients by matrices of 16 bit constants.
+ * Neighbouring coefficients and constants are taken in pairs, so on the
+ * Cortex-M4 each pair is a single SMLAD instruction (core_cm4_simd.h),
+ * as is the green component of the color conversion. The host build
+ * (see sim) uses plain C versions of the instructions.
+ *
+ * Progressive, arithmetic coded and 12 bit files are not supported.
+ * Chroma is upsampled by replicating samples, except for scaled down
+ * 4:2:0 images, whose chroma blocks get an IDCT twice as large.
+ *
+ * @verbatim
+ * Copyright (c) 2026 agent.
+ * All rights reserved. This program and the
+ * accompanying materials are made available
+ * under the terms of the GNU Public License
+ * v3.0 which accompanies this distribution,
+ * and is available at
+ * http://www.gnu.org/licenses/gpl.html
+ * @endverbatim
+ */
+
+#include <jpeg.h>
+#include <fat.h>
+#include <string.h>
+
+#if defined(__ARM_FEATURE_DSP)
+#include <stm32f4xx.h> // DSP instructions from core_cm4_simd.h
+#endif
+
+/**
+ * @addtogroup JPEG
+ * @{
+ */
+
+#define JPEG_BUF_SIZE       512 ///< Bytes read from file at once
+#define JPEG_MAX_COMPONENTS 3   ///< Y, Cb and Cr
+#define JPEG_MAX_BLOCKS     6   ///< Blocks in MCU (four Y blocks of 4:2:0 and two chroma ones)
+#define JPEG_IDCT_BITS      13  ///< Fraction bits of IDCT matrices
+#define JPEG_PASS1_BITS     2   ///< Fraction bits kept between the IDCT passes
+#define JPEG_COLOR_BITS     14  ///< Fraction bits of color conversion factors
+
+#if defined(__ARM_FEATURE_DSP)
+#define JPEG_DOT2(a, b, acc) ((int32_t)__SMLAD((a), (b), (uint32_t)(acc)))
+#define JPEG_SAT16(x)        ((int32_t)__SSAT((x), 16))
+#define JPEG_SAT8(x)         ((int32_t)__USAT((x), 8))
+#else
+#define JPEG_DOT2(a, b, acc) ((acc) + \
+    (int16_t)(a) * (int16_t)(b) + (int16_t)((a) >> 16) * (int16_t)((b) >> 16))
+#define JPEG_SAT16(x) ((x) < -32768 ? -32768 : ((x) > 32767 ? 32767 : (x)))
+#define JPEG_SAT8(x)  ((x) < 0 ? 0 : ((x) > 255 ? 255 : (x)))
+#endif
+
+/**
+ * @brief Two 16 bit values in a word, as DSP instructions take them.
+ */
+#define JPEG_PACK(lo, hi) \
+  ((uint32_t)(uint16_t)(lo) | ((uint32_t)(uint16_t)(hi) << 16))
+
+/**
+ * @brief 8x8 block of 16 bit values.
+ */
+typedef union {
+  int16_t h[64];  ///< Values, row by row
+  uint32_t w[32]; ///< Pairs of neighbouring values
+} JPEG_BlockUnion;
+
+/**
+ * @brief Huffman table.
+ */
+typedef struct {
+  int32_t maxCode[17];  ///< Largest code of each length (-1 - no codes)
+  int32_t offset[17];   ///< Index of first symbol minus first code of each length
+  uint8_t symbols[162]; ///< Symbols in order of codes
+  uint8_t total;        ///< Number of symbols
+} JPEG_HuffmanStruct;
+
+/**
+ * @brief Component of image.
+ */
+typedef struct {
+  uint8_t id;    ///< Identifier used by the scan header
+  uint8_t h;     ///< Horizontal sampling factor
+  uint8_t v;     ///< Vertical sampling factor
+  uint8_t quant; ///< Quantization table
+  uint8_t dc;    ///< DC Huffman table
+  uint8_t ac;    ///< AC Huffman table
+  uint8_t size;  ///< Size of IDCT (decoded block after scaling)
+  int pred;      ///< DC value of previous block
+} JPEG_ComponentStruct;
+
+/**
+ * @brief State of decoder - all its working memory.
+ */
+typedef struct {
+  int file;                       ///< Decoded file
+  uint32_t filePos;               ///< Position in file after the buffer
+  uint8_t buf[JPEG_BUF_SIZE];     ///< Data read from file
+  uint16_t pos;                   ///< Next byte in buffer
+  uint16_t len;                   ///< Number of bytes in buffer
+  uint8_t eof;                    ///< End of file or read error
+  uint8_t marker;                 ///< Marker reached in coded data (0 - none)
+  uint32_t bits;                  ///< Bits of coded data, MSB first
+  int count;                      ///< Number of bits in bits
+  JPEG_HuffmanStruct huffman[4];  ///< DC tables 0, 1 and AC tables 0, 1
+  uint8_t quant[4][64];           ///< Quantization tables (zigzag order)
+  JPEG_ComponentStruct comp[JPEG_MAX_COMPONENTS]; ///< Components of image
+  uint8_t components;             ///< Number of components
+  uint8_t hMax;                   ///< Largest horizontal sampling factor
+  uint8_t vMax;                   ///< Largest vertical sampling factor
+  uint16_t width;                 ///< Width of image
+  uint16_t height;                ///< Height of image
+  uint16_t restart;               ///< Restart interval in MCUs (0 - none)
+  JPEG_BlockUnion coef;           ///< Dequantized coefficients of block
+  JPEG_BlockUnion ws;             ///< Block after the first IDCT pass (transposed)
+  uint8_t samples[JPEG_MAX_BLOCKS][64]; ///< Decoded blocks of MCU
+  uint16_t pixels[2][JPEG_MAX_MCU * JPEG_MAX_MCU]; ///< Converted MCUs
+} JPEG_DecoderStruct;
+
+static JPEG_DecoderStruct jpeg; ///< Decoder
+
+/**
+ * @brief Natural order index of coefficients in zigzag order.
+ */
+static const uint8_t zigzag[64] = {
+     0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+    12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+/**
+ * @brief Matrices of the 8, 4 and 2 point IDCT.
+ *
+ * @details Element [x][u] is C(u) / 2 * cos((2x + 1) * u * pi / 2n),
+ * where C(0) = 1 / sqrt(2) and C(u) = 1 otherwise (JPEG_IDCT_BITS
+ * fraction bits). Smaller matrices give the image scaled down
+ * from the lowest frequencies of a block.
+ */
+static const JPEG_BlockUnion idct8 = {{
+    2896,  4017,  3784,  3406,  2896,  2276,  1567,   799,
+    2896,  3406,  1567,  -799, -2896, -4017, -3784, -2276,
+    2896,  2276, -1567, -4017, -2896,   799,  3784,  3406,
+    2896,   799, -3784, -2276,  2896,  3406, -1567, -4017,
+    2896,  -799, -3784,  2276,  2896, -3406, -1567,  4017,
+    2896, -2276, -1567,  4017, -2896,  -799,  3784, -3406,
+    2896, -3406,  1567,   799, -2896,  4017, -3784,  2276,
+    2896, -4017,  3784, -3406,  2896, -2276,  1567,  -799,
+}};
+static const JPEG_BlockUnion idct4 = {{
+    2896,  3784,  2896,  1567,
+    2896,  1567, -2896, -3784,
+    2896, -1567, -2896,  3784,
+    2896, -3784,  2896, -1567,
+}};
+static const JPEG_BlockUnion idct2 = {{
+    2896,  2896,
+    2896, -2896,
+}};
+
+static int JPEG_ReadHeaders(void);
+static int JPEG_ReadFrame(int len);
+static int JPEG_ReadHuffman(int len);
+static int JPEG_ReadQuant(int len);
+static int JPEG_ReadScan(int len);
+static uint8_t JPEG_ReadByte(void);
+static uint16_t JPEG_Read16(void);
+static void JPEG_Skip(int len);
+static void JPEG_FillBits(void);
+static uint32_t JPEG_GetBits(int n);
+static int JPEG_Extend(uint32_t v, int n);
+static int JPEG_DecodeSymbol(const JPEG_HuffmanStruct* table);
+static int JPEG_Restart(void);
+static int JPEG_DecodeBlock(JPEG_ComponentStruct* comp, uint8_t* out);
+static void JPEG_Idct(int n, uint8_t* out);
+static void JPEG_ConvertMcu(uint16_t* dst, int n, int w, int h);
+
+/**
+ * @brief Decodes a JPEG file.
+ *
+ * @details Blocks are passed to the output function MCU by MCU, left
+ * to right and top to bottom. An MCU is up to JPEG_MAX_MCU pixels
+ * wide and high (less when the image is scaled down) - blocks at the
+ * right and bottom edges are cut to the size of the image.
+ *
+ * @param file Opened file (see FAT_OpenFile()), read from the start
+ * @param scale Image is scaled down 1, 2, 4 or 8 times
+ * @param output Function receiving decoded blocks
+ * @retval 0 Image decoded
+ * @retval -1 Read error or file truncated
+ * @retval -2 Unsupported or corrupted file
+ */
+int JPEG_Decode(int file, uint8_t scale, JPEG_OutputCb output) {
+
+  int ret;
+  int buffer = 0;
+
+  if (scale != 1 && scale != 2 && scale != 4 && scale != 8) {
+    return -2;
+  }
+
+  jpeg.file = file;
+  jpeg.filePos = 0;
+  jpeg.pos = 0;
+  jpeg.len = 0;
+  jpeg.eof = 0;
+  jpeg.marker = 0;
+  jpeg.bits = 0;
+  jpeg.count = 0;
+  jpeg.components = 0;
+  jpeg.restart = 0;
+  // tables not defined by the file have no codes
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 17; j++) {
+      jpeg.huffman[i].maxCode[j] = -1;
+    }
+  }
+
+  ret = JPEG_ReadHeaders();
+  if (ret) {
+    return ret;
+  }
+
+  // size of block and MCU after scaling
+  const int n = 8 / scale;
+  const int mcuWidth = jpeg.hMax * n;
+  const int mcuHeight = jpeg.vMax * n;
+  const int width = (jpeg.width * n + 7) / 8;
+  const int height = (jpeg.height * n + 7) / 8;
+  const int mcusX = (jpeg.width + 8 * jpeg.hMax - 1) / (8 * jpeg.hMax);
+  const int mcusY = (jpeg.height + 8 * jpeg.vMax - 1) / (8 * jpeg.vMax);
+  int mcu = 0;
+
+  // chroma of a scaled down image is decoded by a larger IDCT instead
+  // of being upsampled, as long as it is subsampled the same both ways
+  for (int c = 0; c < jpeg.components; c++) {
+    JPEG_ComponentStruct* comp = &jpeg.comp[c];
+    comp->size = n;
+    if (jpeg.hMax / comp->h == jpeg.vMax / comp->v) {
+      while (comp->size < 8 && comp->size * comp->h < mcuWidth) {
+        comp->size <<= 1;
+      }
+    }
+  }
+
+  for (int my = 0; my < mcusY; my++) {
+    for (int mx = 0; mx < mcusX; mx++, mcu++) {
+
+      if (jpeg.restart && mcu && mcu % jpeg.restart == 0) {
+        if (JPEG_Restart()) {
+          return jpeg.eof ? -1 : -2;
+        }
+      }
+
+      int block = 0;
+      for (int c = 0; c < jpeg.components; c++) {
+        for (int i = 0; i < jpeg.comp[c].h * jpeg.comp[c].v; i++) {
+          if (JPEG_DecodeBlock(&jpeg.comp[c], jpeg.samples[block++])) {
+            return -2;
+          }
+        }
+      }
+
+      const int x = mx * mcuWidth;
+      const int y = my * mcuHeight;
+      const int w = (width - x < mcuWidth) ? width - x : mcuWidth;
+      const int h = (height - y < mcuHeight) ? height - y : mcuHeight;
+
+      // the other buffer may still be sent
+      JPEG_ConvertMcu(jpeg.pixels[buffer], n, w, h);
+      output(x, y, w, h, jpeg.pixels[buffer]);
+      buffer ^= 1;
+    }
+  }
+
+  return jpeg.eof ? -1 : 0;
+}
+/**
+ * @brief Reads markers up to the start of the scan.
+ * @retval 0 Scan starts
+ * @retval -1 Read error
+ * @retval -2 Unsupported or corrupted file
+ */
+static int JPEG_ReadHeaders(void) {
+
+  uint8_t marker;
+  int len;
+  int ret;
+
+  if (JPEG_Read16() != 0xffd8) { // SOI
+    return jpeg.eof ? -1 : -2;
+  }
+
+  while (1) {
+
+    // markers may be preceded by any number of 0xff
+    if (JPEG_ReadByte() != 0xff) {
+      return jpeg.eof ? -1 : -2;
+    }
+    do {
+      marker = JPEG_ReadByte();
+    } while (marker == 0xff);
+
+    len = JPEG_Read16() - 2;
+    if (jpeg.eof) {
+      return -1;
+    }
+    if (len < 0) {
+      return -2;
+    }
+
+    switch (marker) {
+    case 0xc0: // SOF0 - baseline
+    case 0xc1: // SOF1 - extended sequential, Huffman coding
+      ret = JPEG_ReadFrame(len);
+      break;
+    case 0xc4: // DHT
+      ret = JPEG_ReadHuffman(len);
+      break;
+    case 0xdb: // DQT
+      ret = JPEG_ReadQuant(len);
+      break;
+    case 0xdd: // DRI
+      jpeg.restart = JPEG_Read16();
+      JPEG_Skip(len - 2);
+      ret = 0;
+      break;
+    case 0xda: // SOS
+      return JPEG_ReadScan(len);
+    default:
+      // other frame types - progressive, lossless, arithmetic coding
+      if (marker >= 0xc2 && marker <= 0xcf) {
+        return -2;
+      }
+      JPEG_Skip(len); // APPn, COM
+      ret = 0;
+      break;
+    }
+
+    if (jpeg.eof) {
+      return -1;
+    }
+    if (ret) {
+      return ret;
+    }
+  }
+}
+/**
+ * @brief Reads the frame header (SOF).
+ * @param len Length of segment
+ * @retval 0 Header read
+ * @retval -2 Unsupported frame
+ */
+static int JPEG_ReadFrame(int len) {
+
+  const uint8_t precision = JPEG_ReadByte();
+  jpeg.height = JPEG_Read16();
+  jpeg.width = JPEG_Read16();
+  jpeg.components = JPEG_ReadByte();
+
+  if (precision != 8 || jpeg.width == 0 || jpeg.height == 0 ||
+      (jpeg.components != 1 && jpeg.components != 3) ||
+      len != 6 + 3 * jpeg.components) {
+    jpeg.components = 0;
+    return -2;
+  }
+
+  jpeg.hMax = 1;
+  jpeg.vMax = 1;
+  for (int i = 0; i < jpeg.components; i++) {
+    JPEG_ComponentStruct* c = &jpeg.comp[i];
+    c->id = JPEG_ReadByte();
+    c->h = JPEG_ReadByte();
+    c->v = c->h & 0x0f;
+    c->h >>= 4;
+    c->quant = JPEG_ReadByte() & 0x03;
+    if (c->h < 1 || c->h > 2 || c->v < 1 || c->v > 2) {
+      return -2;
+    }
+    // a single component is not interleaved - every MCU is one block
+    if (jpeg.components == 1) {
+      c->h = 1;
+      c->v = 1;
+    }
+    jpeg.hMax = (c->h > jpeg.hMax) ? c->h : jpeg.hMax;
+    jpeg.vMax = (c->v > jpeg.vMax) ? c->v : jpeg.vMax;
+  }
+
+  // only whole ratios of sampling factors (upsampling by 1 or 2)
+  int blocks = 0;
+  for (int i = 0; i < jpeg.components; i++) {
+    if (jpeg.hMax % jpeg.comp[i].h || jpeg.vMax % jpeg.comp[i].v) {
+      return -2;
+    }
+    blocks += jpeg.comp[i].h * jpeg.comp[i].v;
+  }
+
+  return (blocks <= JPEG_MAX_BLOCKS) ? 0 : -2;
+}
+/**
+ * @brief Reads Huffman tables (DHT).
+ * @param len Length of segment
+ * @retval 0 Tables read
+ * @retval -2 Corrupted table
+ */
+static int JPEG_ReadHuffman(int len) {
+
+  uint8_t counts[16];
+
+  while (len > 0) {
+
+    const uint8_t id = JPEG_ReadByte();
+    // class (DC - 0, AC - 1) and number of table (0 or 1 in baseline)
+    if ((id >> 4) > 1 || (id & 0x0f) > 1) {
+      return -2;
+    }
+    JPEG_HuffmanStruct* t = &jpeg.huffman[((id >> 4) << 1) | (id & 0x0f)];
+
+    int total = 0;
+    for (int i = 0; i < 16; i++) {
+      counts[i] = JPEG_ReadByte();
+      total += counts[i];
+    }
+    if (total > (int)sizeof(t->symbols)) {
+      return -2;
+    }
+    for (int i = 0; i < total; i++) {
+      t->symbols[i] = JPEG_ReadByte();
+    }
+    t->total = total;
+
+    // codes of each length are consecutive numbers
+    int32_t code = 0;
+    int k = 0;
+    for (int l = 1; l <= 16; l++) {
+      t->offset[l] = k - code;
+      code += counts[l - 1];
+      k += counts[l - 1];
+      t->maxCode[l] = counts[l - 1] ? code - 1 : -1;
+      code <<= 1;
+    }
+
+    len -= 17 + total;
+  }
+
+  return len ? -2 : 0;
+}
+/**
+ * @brief Reads quantization tables (DQT).
+ * @param len Length of segment
+ * @retval 0 Tables read
+ * @retval -2 Unsupported table (16 bit)
+ */
+static int JPEG_ReadQuant(int len) {
+
+  while (len > 0) {
+    const uint8_t id = JPEG_ReadByte();
+    if ((id >> 4) || (id & 0x0f) > 3) {
+      return -2;
+    }
+    for (int i = 0; i < 64; i++) {
+      jpeg.quant[id][i] = JPEG_ReadByte();
+    }
+    len -= 65;
+  }
+
+  return len ? -2 : 0;
+}
+/**
+ * @brief Reads the scan header (SOS).
+ *
+ * @details The scan has to contain all components of image.
+ *
+ * @param len Length of segment
+ * @retval 0 Coded data starts
+ * @retval -1 Read error
+ * @retval -2 Unsupported scan
+ */
+static int JPEG_ReadScan(int len) {
+
+  const uint8_t count = JPEG_ReadByte();
+
+  if (!jpeg.components || count != jpeg.components ||
+      len != 4 + 2 * count) {
+    return -2;
+  }
+
+  for (int i = 0; i < count; i++) {
+    const uint8_t id = JPEG_ReadByte();
+    const uint8_t tables = JPEG_ReadByte();
+    int c;
+    for (c = 0; c < jpeg.components && jpeg.comp[c].id != id; c++);
+    if (c == jpeg.components || (tables >> 4) > 1 || (tables & 0x0f) > 1) {
+      return -2;
+    }
+    jpeg.comp[c].dc = tables >> 4;
+    jpeg.comp[c].ac = 2 + (tables & 0x0f);
+    jpeg.comp[c].pred = 0;
+  }
+
+  // spectral selection and approximation of a sequential scan
+  const uint8_t start = JPEG_ReadByte();
+  const uint8_t end = JPEG_ReadByte();
+  const uint8_t approx = JPEG_ReadByte();
+  if (jpeg.eof) {
+    return -1;
+  }
+
+  return (start == 0 && end == 63 && approx == 0) ? 0 : -2;
+}
+/**
+ * @brief Reads a byte from the file.
+ * @return Byte or 0 after the end of file
+ */
+static uint8_t JPEG_ReadByte(void) {
+
+  if (jpeg.pos == jpeg.len) {
+    const int n = FAT_ReadFile(jpeg.file, jpeg.buf, JPEG_BUF_SIZE);
+    if (n <= 0) {
+      jpeg.eof = 1;
+      return 0;
+    }
+    jpeg.filePos += n;
+    jpeg.len = n;
+    jpeg.pos = 0;
+  }
+
+  return jpeg.buf[jpeg.pos++];
+}
+/**
+ * @brief Reads a big endian 16 bit value from the file.
+ * @return Value
+ */
+static uint16_t JPEG_Read16(void) {
+
+  const uint16_t hi = JPEG_ReadByte();
+  return (hi << 8) | JPEG_ReadByte();
+}
+/**
+ * @brief Skips bytes of the file.
+ *
+ * @details Segments longer than the buffer (thumbnails of APPn
+ * segments) are skipped by moving the read pointer of the file.
+ *
+ * @param len Number of bytes
+ */
+static void JPEG_Skip(int len) {
+
+  if (len <= jpeg.len - jpeg.pos) {
+    jpeg.pos += len;
+    return;
+  }
+
+  jpeg.filePos += len - (jpeg.len - jpeg.pos);
+  jpeg.pos = 0;
+  jpeg.len = 0;
+  if (FAT_MoveRdPtr(jpeg.file, jpeg.filePos) < 0) {
+    jpeg.eof = 1;
+  }
+}
+/**
+ * @brief Fills the bit buffer with at least 25 bits of coded data.
+ *
+ * @details Stuffed zero bytes after 0xff are removed. After a marker
+ * the data ends and the buffer is filled with zeros.
+ */
+static void JPEG_FillBits(void) {
+
+  while (jpeg.count <= 24) {
+
+    uint32_t byte = 0;
+
+    if (!jpeg.marker) {
+      byte = JPEG_ReadByte();
+      if (byte == 0xff) {
+        uint8_t next;
+        do {
+          next = JPEG_ReadByte();
+        } while (next == 0xff);
+        if (next) {
+          jpeg.marker = next;
+          byte = 0;
+        }
+      }
+    }
+
+    jpeg.bits |= byte << (24 - jpeg.count);
+    jpeg.count += 8;
+  }
+}
+/**
+ * @brief Takes bits of coded data.
+ * @param n Number of bits (1 - 16)
+ * @return Bits
+ */
+static uint32_t JPEG_GetBits(int n) {
+
+  JPEG_FillBits();
+
+  const uint32_t v = jpeg.bits >> (32 - n);
+  jpeg.bits <<= n;
+  jpeg.count -= n;
+
+  return v;
+}
+/**
+ * @brief Converts bits of a coefficient to its value.
+ * @param v Bits
+ * @param n Number of bits (category of value)
+ * @return Value
+ */
+static int JPEG_Extend(uint32_t v, int n) {
+
+  // values starting with 0 are negative
+  return (v < (1U << (n - 1))) ? (int)v - (1 << n) + 1 : (int)v;
+}
+/**
+ * @brief Decodes a Huffman coded symbol.
+ * @param table Huffman table
+ * @return Symbol or -1 for an invalid code
+ */
+static int JPEG_DecodeSymbol(const JPEG_HuffmanStruct* table) {
+
+  JPEG_FillBits();
+
+  const uint32_t look = jpeg.bits >> 16; // the longest code
+
+  for (int l = 1; l <= 16; l++) {
+    const int32_t code = look >> (16 - l);
+    if (code <= table->maxCode[l]) {
+      jpeg.bits <<= l;
+      jpeg.count -= l;
+      const int32_t i = code + table->offset[l];
+      return (i < table->total) ? table->symbols[i] : -1;
+    }
+  }
+
+  return -1;
+}
+/**
+ * @brief Handles a restart marker.
+ *
+ * @details The coded data before the marker ends on a byte boundary,
+ * the DC predictions start from 0 again.
+ *
+ * @retval 0 Decoding continues after the marker
+ * @retval -1 No restart marker
+ */
+static int JPEG_Restart(void) {
+
+  jpeg.bits = 0;
+  jpeg.count = 0;
+
+  // the marker has not been reached by the bit buffer yet
+  while (!jpeg.marker && !jpeg.eof) {
+    if (JPEG_ReadByte() == 0xff) {
+      uint8_t next;
+      do {
+        next = JPEG_ReadByte();
+      } while (next == 0xff);
+      jpeg.marker = next;
+    }
+  }
+
+  if (jpeg.marker < 0xd0 || jpeg.marker > 0xd7) { // RST0 - RST7
+    return -1;
+  }
+
+  jpeg.marker = 0;
+  for (int c = 0; c < jpeg.components; c++) {
+    jpeg.comp[c].pred = 0;
+  }
+
+  return 0;
+}
+/**
+ * @brief Decodes a block of a component.
+ *
+ * @details Only the coefficients used by the n point IDCT (n is the
+ * size of the component's IDCT) are dequantized. A block without them
+ * is flat - its value is the DC coefficient (divided by 8).
+ *
+ * @param comp Component
+ * @param out Decoded samples (n x n)
+ * @retval 0 Block decoded
+ * @retval -1 Corrupted data
+ */
+static int JPEG_DecodeBlock(JPEG_ComponentStruct* comp, uint8_t* out) {
+
+  const int n = comp->size;
+  const uint8_t* q = jpeg.quant[comp->quant];
+  uint8_t ac = 0;
+  int s;
+
+  if (n > 1) {
+    memset(jpeg.coef.h, 0, sizeof(jpeg.coef.h));
+  }
+
+  s = JPEG_DecodeSymbol(&jpeg.huffman[comp->dc]);
+  if (s < 0 || s > 16) {
+    return -1;
+  }
+  if (s) {
+    comp->pred += JPEG_Extend(JPEG_GetBits(s), s);
+  }
+  const int dc = comp->pred * q[0];
+
+  for (int k = 1; k < 64; k++) {
+    s = JPEG_DecodeSymbol(&jpeg.huffman[comp->ac]);
+    if (s < 0) {
+      return -1;
+    }
+    const int zeros = s >> 4;
+    s &= 0x0f;
+    if (!s) {
+      if (zeros != 15) {
+        break; // end of block
+      }
+      k += 15; // 16 zeros
+      continue;
+    }
+    k += zeros;
+    if (k > 63) {
+      return -1;
+    }
+    const int v = JPEG_Extend(JPEG_GetBits(s), s);
+    const int z = zigzag[k];
+    if ((z & 7) < n && (z >> 3) < n) {
+      const int32_t value = v * q[k];
+      jpeg.coef.h[z] = JPEG_SAT16(value);
+      ac = 1;
+    }
+  }
+
+  if (!ac) {
+    const int32_t value = ((dc + 4) >> 3) + 128;
+    memset(out, JPEG_SAT8(value), n * n);
+    return 0;
+  }
+
+  jpeg.coef.h[0] = JPEG_SAT16(dc);
+  JPEG_Idct(n, out);
+
+  return 0;
+}
+/**
+ * @brief Computes the n x n IDCT of the coefficients.
+ *
+ * @details The first pass transforms rows of coefficients and stores
+ * them as columns, so both passes multiply pairs of neighbouring
+ * values by pairs of matrix elements.
+ *
+ * @param n Size of IDCT (8, 4 or 2)
+ * @param out Samples (n x n)
+ */
+static void JPEG_Idct(int n, uint8_t* out) {
+
+  const uint32_t* m = (n == 8) ? idct8.w : ((n == 4) ? idct4.w : idct2.w);
+  const int pairs = n / 2;
+  int32_t sum;
+
+  for (int v = 0; v < n; v++) {
+    const uint32_t* row = &jpeg.coef.w[v * 4];
+    uint32_t any = 0;
+    for (int p = 0; p < pairs; p++) {
+      any |= row[p];
+    }
+    if (!any) { // most rows of high frequencies are empty
+      for (int x = 0; x < n; x++) {
+        jpeg.ws.h[x * 8 + v] = 0;
+      }
+      continue;
+    }
+    for (int x = 0; x < n; x++) {
+      sum = 1 << (JPEG_IDCT_BITS - JPEG_PASS1_BITS - 1);
+      for (int p = 0; p < pairs; p++) {
+        sum = JPEG_DOT2(row[p], m[x * pairs + p], sum);
+      }
+      sum >>= JPEG_IDCT_BITS - JPEG_PASS1_BITS;
+      jpeg.ws.h[x * 8 + v] = JPEG_SAT16(sum);
+    }
+  }
+
+  for (int x = 0; x < n; x++) {
+    const uint32_t* col = &jpeg.ws.w[x * 4];
+    for (int y = 0; y < n; y++) {
+      // rounding and level shift (+128)
+      sum = (128 << (JPEG_IDCT_BITS + JPEG_PASS1_BITS)) +
+          (1 << (JPEG_IDCT_BITS + JPEG_PASS1_BITS - 1));
+      for (int p = 0; p < pairs; p++) {
+        sum = JPEG_DOT2(col[p], m[y * pairs + p], sum);
+      }
+      sum >>= JPEG_IDCT_BITS + JPEG_PASS1_BITS;
+      out[y * n + x] = JPEG_SAT8(sum);
+    }
+  }
+}
+/**
+ * @brief Converts decoded blocks of MCU to RGB565.
+ *
+ * @details Components with fewer samples than the MCU has pixels
+ * are upsampled by repeating their samples.
+ *
+ * @param dst Pixels (w x h)
+ * @param n Size of block after scaling
+ * @param w Width of MCU (cut at the right edge of image)
+ * @param h Height of MCU (cut at the bottom edge of image)
+ */
+static void JPEG_ConvertMcu(uint16_t* dst, int n, int w, int h) {
+
+  int block[JPEG_MAX_COMPONENTS];
+  int bits[JPEG_MAX_COMPONENTS];
+  int shiftX[JPEG_MAX_COMPONENTS];
+  int shiftY[JPEG_MAX_COMPONENTS];
+  int first = 0;
+  uint8_t s[JPEG_MAX_COMPONENTS];
+
+  // first block, size of block and upsampling (0 or 1 bit) of every component
+  for (int c = 0; c < jpeg.components; c++) {
+    const JPEG_ComponentStruct* comp = &jpeg.comp[c];
+    block[c] = first;
+    for (bits[c] = 0; (1 << bits[c]) < comp->size; bits[c]++);
+    shiftX[c] = (comp->h * comp->size < jpeg.hMax * n) ? 1 : 0;
+    shiftY[c] = (comp->v * comp->size < jpeg.vMax * n) ? 1 : 0;
+    first += comp->h * comp->v;
+  }
+
+  for (int y = 0; y < h; y++) {
+    for (int x = 0; x < w; x++) {
+
+      for (int c = 0; c < jpeg.components; c++) {
+        const int cx = x >> shiftX[c];
+        const int cy = y >> shiftY[c];
+        const int mask = (1 << bits[c]) - 1;
+        const int b = block[c] + (cy >> bits[c]) * jpeg.comp[c].h +
+            (cx >> bits[c]);
+        s[c] = jpeg.samples[b][((cy & mask) << bits[c]) + (cx & mask)];
+      }
+
+      int32_t r = s[0];
+      int32_t g = s[0];
+      int32_t b = s[0];
+
+      if (jpeg.components == 3) {
+        const int cb = s[1] - 128;
+        const int cr = s[2] - 128;
+        const int half = 1 << (JPEG_COLOR_BITS - 1);
+        // R = Y + 1.402 Cr, G = Y - 0.344 Cb - 0.714 Cr, B = Y + 1.772 Cb
+        r += (22970 * cr + half) >> JPEG_COLOR_BITS;
+        g += JPEG_DOT2(JPEG_PACK(cb, cr), JPEG_PACK(-5638, -11700), half) >>
+            JPEG_COLOR_BITS;
+        b += (29032 * cb + half) >> JPEG_COLOR_BITS;
+        r = JPEG_SAT8(r);
+        g = JPEG_SAT8(g);
+        b = JPEG_SAT8(b);
+      }
+
+      *dst++ = ((r & 0xf8) << 8) | ((g & 0xfc) << 3) | (b >> 3);
+    }
+  }
+}
+/**
+ * @}
+ */
@@ -0,0 +1,364 @@
+/**
+ * @file    strip.c
+ * @brief   Band renderer of a display list.
+ * @date    16 paź 2026
+ * @author  agent
+ *
+ * @details A scene is described by a list of GRAPH_* primitives
+ * and rendered with STRIP_Render() band by band: every band of
+ * STRIP_BAND_HEIGHT full width rows is rasterized in RAM by
+ * replaying the list (only the primitives which reach the band
+ * are drawn) and sent to the LCD by DMA, while the next band is
+ * rendered in the second buffer. Every pixel of the screen is
+ * written to the LCD exactly once, whatever the overdraw of the
+ * scene, and the whole renderer needs two 10 KB band buffers
+ * instead of a 150 KB framebuffer.
+ *
+ * Lines pinned with GRAPH_PinRegion() are neither rendered nor sent.
+ *
+ * The list keeps pointers to strings, fonts and images, so they have to
+ * stay valid until the list is cleared.
+ *
+ * @verbatim
+ * Copyright (c) 2026 agent.
+ * All rights reserved. This program and the
+ * accompanying materials are made available
+ * under the terms of the GNU Public License
+ * v3.0 which accompanies this distribution,
+ * and is available at
+ * http://www.gnu.org/licenses/gpl.html
+ * @endverbatim
+ */
+
+#include <strip.h>
+#include <ili9320.h>
+#include <string.h>
+
+/**
+ * @addtogroup STRIP
+ * @{
+ */
+
+#define STRIP_MAX_ITEMS 64  ///< Maximum number of entries in display list
+
+/**
+ * @brief Display list entry types.
+ */
+typedef enum {
+  STRIP_COLOR,    ///< GRAPH_SetColor()
+  STRIP_BG_COLOR, ///< GRAPH_SetBgColor()
+  STRIP_FONT,     ///< GRAPH_SetFont()
+  STRIP_RECT,     ///< GRAPH_DrawRectangle()
+  STRIP_LINE,     ///< GRAPH_DrawLine()
+  STRIP_CIRCLE,   ///< GRAPH_DrawCircle()
+  STRIP_STRING,   ///< GRAPH_DrawString()
+  STRIP_IMAGE,    ///< GRAPH_DrawImage()
+} STRIP_ItemType;
+
+/**
+ * @brief Display list entry.
+ */
+typedef struct {
+  STRIP_ItemType type;  ///< Type of entry
+  uint16_t p[4];        ///< Parameters of the called function
+  const void* ptr;      ///< String, font or image
+  int top;              ///< First row reached by the primitive
+  int bottom;           ///< Last row reached by the primitive
+} STRIP_ItemTypeDef;
+
+static STRIP_ItemTypeDef items[STRIP_MAX_ITEMS]; ///< Display list
+static uint8_t itemCount;                        ///< Number of entries in list
+static uint8_t background[3];                    ///< Color of empty screen (RGB)
+static const GRAPH_FontStruct* listFont;         ///< Font set by last STRIP_SetFont()
+
+/**
+ * @brief Band buffers - one is sent to the LCD while
+ * the other one is rendered.
+ */
+static uint16_t bands[2][ILI9320_WIDTH * STRIP_BAND_HEIGHT];
+
+static int STRIP_Add(STRIP_ItemType type, uint16_t p0, uint16_t p1,
+    uint16_t p2, uint16_t p3, const void* ptr, int top, int bottom);
+static void STRIP_Draw(const STRIP_ItemTypeDef* item);
+static void STRIP_SendPart(const uint16_t* buf, int x, int w, int y, int h);
+
+/**
+ * @brief Empties the display list.
+ * @param r Red component of background
+ * @param g Green component of background
+ * @param b Blue component of background
+ */
+void STRIP_Clear(uint8_t r, uint8_t g, uint8_t b) {
+
+  itemCount = 0;
+  listFont = 0;
+  background[0] = r;
+  background[1] = g;
+  background[2] = b;
+}
+/**
+ * @brief Adds GRAPH_SetColor() to the display list.
+ * @param r Red
+ * @param g Green
+ * @param b Blue
+ * @retval 0 Entry added
+ * @retval -1 Display list is full
+ */
+int STRIP_SetColor(uint8_t r, uint8_t g, uint8_t b) {
+
+  return STRIP_Add(STRIP_COLOR, r, g, b, 0, 0, 0, ILI9320_HEIGHT - 1);
+}
+/**
+ * @brief Adds GRAPH_SetBgColor() to the display list.
+ * @param r Red
+ * @param g Green
+ * @param b Blue
+ * @retval 0 Entry added
+ * @retval -1 Display list is full
+ */
+int STRIP_SetBgColor(uint8_t r, uint8_t g, uint8_t b) {
+
+  return STRIP_Add(STRIP_BG_COLOR, r, g, b, 0, 0, 0, ILI9320_HEIGHT - 1);
+}
+/**
+ * @brief Adds GRAPH_SetFont() to the display list.
+ * @param font Font information structure.
+ * @retval 0 Entry added
+ * @retval -1 Display list is full
+ */
+int STRIP_SetFont(const GRAPH_FontStruct* font) {
+
+  if (STRIP_Add(STRIP_FONT, 0, 0, 0, 0, font, 0, ILI9320_HEIGHT - 1)) {
+    return -1;
+  }
+  listFont = font;
+  return 0;
+}
+/**
+ * @brief Adds GRAPH_DrawRectangle() to the display list.
+ * @param x X coordinate of start point
+ * @param y Y coordinate of start point
+ * @param w Width
+ * @param h Height
+ * @retval 0 Entry added
+ * @retval -1 Display list is full
+ */
+int STRIP_AddRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+
+  return STRIP_Add(STRIP_RECT, x, y, w, h, 0, y, y + h - 1);
+}
+/**
+ * @brief Adds GRAPH_DrawLine() to the display list.
+ * @param x1 X coordinate of start point
+ * @param y1 Y coordinate of start point
+ * @param x2 X coordinate of end point
+ * @param y2 Y coordinate of end point
+ * @retval 0 Entry added
+ * @retval -1 Display list is full
+ */
+int STRIP_AddLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+
+  return STRIP_Add(STRIP_LINE, x1, y1, x2, y2, 0,
+      y1 < y2 ? y1 : y2, y1 < y2 ? y2 : y1);
+}
+/**
+ * @brief Adds GRAPH_DrawCircle() to the display list.
+ * @param x X coordinate of center
+ * @param y Y coordinate of center
+ * @param radius Radius
+ * @retval 0 Entry added
+ * @retval -1 Display list is full
+ */
+int STRIP_AddCircle(uint16_t x, uint16_t y, uint16_t radius) {
+
+  return STRIP_Add(STRIP_CIRCLE, x, y, radius, 0, 0,
+      (int)y - radius, (int)y + radius);
+}
+/**
+ * @brief Adds GRAPH_DrawString() to the display list.
+ * @param s String to write (has to stay valid until the list is cleared)
+ * @param x X coordinate
+ * @param y Y coordinate
+ * @retval 0 Entry added
+ * @retval -1 Display list is full
+ */
+int STRIP_AddString(const char* s, uint16_t x, uint16_t y) {
+
+  int bottom = ILI9320_HEIGHT - 1;
+
+  // characters are stacked along the Y axis
+  if (listFont) {
+    bottom = y + strlen(s) * listFont->columnCount - 1;
+  }
+
+  return STRIP_Add(STRIP_STRING, x, y, 0, 0, s, y, bottom);
+}
+/**
+ * @brief Adds GRAPH_DrawImage() to the display list.
+ *
+ * @details GRAPH_DrawImage() copies only the rows of
+ * the image which fall in the rendered band.
+ *
+ * @param img Image (has to stay valid until the list is cleared)
+ * @param x X coordinate of top left corner.
+ * @param y Y coordinate of top left corner.
+ * @retval 0 Entry added
+ * @retval -1 Display list is full
+ */
+int STRIP_AddImage(const GRAPH_ImageStruct* img, uint16_t x, uint16_t y) {
+
+  return STRIP_Add(STRIP_IMAGE, x, y, 0, 0, img, y, y + img->rows - 1);
+}
+/**
+ * @brief Renders the display list on the whole screen.
+ *
+ * @details The bands are always sent to the LCD. After rendering,
+ * drawing functions draw on the target selected before (the LCD or
+ * the framebuffer) again, with the color, background color and font
+ * set by the last entries of the list.
+ */
+void STRIP_Render(void) {
+
+  uint16_t* buf;
+  int h;
+  int x, w;
+
+  GRAPH_GetUnpinned(&x, &w);
+
+  for (int y = 0, k = 0; y < ILI9320_HEIGHT; y += STRIP_BAND_HEIGHT, k++) {
+
+    h = ILI9320_HEIGHT - y;
+    if (h > STRIP_BAND_HEIGHT) {
+      h = STRIP_BAND_HEIGHT;
+    }
+
+    // the band sent two bands ago has already been written,
+    // since the previous band waited for it before starting
+    buf = bands[k & 1];
+    GRAPH_SetBand(buf, y, h);
+
+    GRAPH_ClrScreen(background[0], background[1], background[2]);
+
+    for (int i = 0; i < itemCount; i++) {
+      if (items[i].top < y + h && items[i].bottom >= y) {
+        STRIP_Draw(&items[i]);
+      }
+    }
+
+    GRAPH_SetBand(0, 0, 0);
+
+    // waits for the previous band to be sent
+    if (w == ILI9320_WIDTH) {
+      ILI9320_WriteBegin(x, y, w, h);
+      ILI9320_WritePixelsAsync(buf, ILI9320_WIDTH * h, 0);
+      ILI9320_WriteEnd();
+    } else {
+      // the band is in GRAM order - a part crossing the scroll
+      // seam is sent as two windows
+      const int seam = ILI9320_GetScrollSeam();
+      if (x < seam && seam < x + w) {
+        STRIP_SendPart(buf, x, seam - x, y, h);
+        STRIP_SendPart(buf, seam, x + w - seam, y, h);
+      } else {
+        STRIP_SendPart(buf, x, w, y, h);
+      }
+    }
+  }
+
+  ILI9320_WaitTransfer();
+}
+/**
+ * @brief Appends an entry to the display list.
+ * @param type Type of entry
+ * @param p0 First parameter
+ * @param p1 Second parameter
+ * @param p2 Third parameter
+ * @param p3 Fourth parameter
+ * @param ptr String, font or image
+ * @param top First row reached by the primitive
+ * @param bottom Last row reached by the primitive
+ * @retval 0 Entry added
+ * @retval -1 Display list is full
+ */
+static int STRIP_Add(STRIP_ItemType type, uint16_t p0, uint16_t p1,
+    uint16_t p2, uint16_t p3, const void* ptr, int top, int bottom) {
+
+  STRIP_ItemTypeDef* item;
+
+  if (itemCount >= STRIP_MAX_ITEMS) {
+    return -1;
+  }
+
+  item = &items[itemCount++];
+  item->type = type;
+  item->p[0] = p0;
+  item->p[1] = p1;
+  item->p[2] = p2;
+  item->p[3] = p3;
+  item->ptr = ptr;
+  item->top = top;
+  item->bottom = bottom;
+
+  return 0;
+}
+/**
+ * @brief Calls the drawing function of an entry.
+ * @param item Display list entry
+ */
+static void STRIP_Draw(const STRIP_ItemTypeDef* item) {
+
+  const uint16_t* p = item->p;
+
+  switch (item->type) {
+  case STRIP_COLOR:
+    GRAPH_SetColor(p[0], p[1], p[2]);
+    break;
+  case STRIP_BG_COLOR:
+    GRAPH_SetBgColor(p[0], p[1], p[2]);
+    break;
+  case STRIP_FONT:
+    GRAPH_SetFont(*(const GRAPH_FontStruct*)item->ptr);
+    break;
+  case STRIP_RECT:
+    GRAPH_DrawRectangle(p[0], p[1], p[2], p[3]);
+    break;
+  case STRIP_LINE:
+    GRAPH_DrawLine(p[0], p[1], p[2], p[3]);
+    break;
+  case STRIP_CIRCLE:
+    GRAPH_DrawCircle(p[0], p[1], p[2]);
+    break;
+  case STRIP_STRING:
+    GRAPH_DrawString(item->ptr, p[0], p[1]);
+    break;
+  case STRIP_IMAGE:
+    GRAPH_DrawImage(item->ptr, p[0], p[1]);
+    break;
+  }
+}
+/**
+ * @brief Sends columns of a band to the LCD.
+ *
+ * @details The columns must not cross the scroll seam. Every
+ * row is a separate piece of the band buffer.
+ *
+ * @param buf Band buffer (full width rows in GRAM order)
+ * @param x X coordinate of first column (logical)
+ * @param w Number of columns
+ * @param y Y coordinate of band
+ * @param h Height of band
+ */
+static void STRIP_SendPart(const uint16_t* buf, int x, int w, int y, int h) {
+
+  const int col = (x + ILI9320_GetScroll()) % ILI9320_WIDTH;
+
+  ILI9320_WriteBegin(x, y, w, h);
+  for (int row = 0; row < h; row++) {
+    ILI9320_WritePixelsAsync(buf + row * ILI9320_WIDTH + col, w, 0);
+  }
+  ILI9320_WriteEnd();
+}
+
+/**
+ * @}
+ */
@@ -65,7 +65,7 @@ uint32_t ntohl(uint32_t val) {
  * @param length Number of bytes to send.
  * @warning Uses blocking delays so as not to overflow buffer.
  */
-void hexdump(const uint8_t const *buf, uint32_t length) {
+void hexdump(const uint8_t* buf, uint32_t length) {
 
   uint32_t i = 0;
 
@@ -92,7 +92,7 @@ void hexdump(const uint8_t const *buf, uint32_t length) {
  * @param length Number of bytes to send.
  * @warning Uses blocking delays so as not to overflow buffer.
  */
-void hexdumpC(const uint8_t const *buf, uint32_t length) {
+void hexdumpC(const uint8_t* buf, uint32_t length) {
 
   uint32_t i = 0;
 
@@ -123,7 +123,7 @@ void hexdumpC(const uint8_t const *buf, uint32_t length) {
  * @param length Number of bytes to send.
  * @warning Uses blocking delays so as not to overflow buffer.
  */
-void hexdump16C(const uint16_t const *buf, uint32_t length) {
+void hexdump16C(const uint16_t* buf, uint32_t length) {
 
   uint32_t i = 0;
 
@@ -18,11 +18,26 @@
 #ifndef INC_ILI9320_HAL_H_
 #define INC_ILI9320_HAL_H_
 
+#define ILI9320_HAL_ADDRESS_SETUP 4   ///< Safe address setup time (HCLK cycles)
+#define ILI9320_HAL_DATA_SETUP    20  ///< Safe data setup time (HCLK cycles)
 
 uint16_t ILI9320_HAL_ReadReg(uint16_t reg);
 void ILI9320_HAL_HardInit(void);
 void ILI9320_HAL_WriteReg(uint16_t reg, uint16_t data);
+void ILI9320_HAL_WriteIndex(uint16_t reg);
+void ILI9320_HAL_WriteData(uint16_t data);
+uint16_t ILI9320_HAL_ReadData(void);
+void ILI9320_HAL_ReadDataBuffer(uint16_t* buf, uint32_t len);
+void ILI9320_HAL_WriteDataBuffer(const uint16_t* buf, uint32_t len);
+void ILI9320_HAL_FillData(uint16_t data, uint32_t len);
+void ILI9320_HAL_DMAFill(uint16_t data, uint32_t len, void (*cb)(void));
+void ILI9320_HAL_DMAWrite(const uint16_t* buf, uint32_t len, void (*cb)(void));
+uint8_t ILI9320_HAL_DMABusy(void);
 void ILI9320_HAL_ResetOn(void);
 void ILI9320_HAL_ResetOff(void);
+void ILI9320_HAL_SetWriteTiming(uint8_t addressSetup, uint8_t dataSetup);
+void ILI9320_HAL_FmarkInit(void (*cb)(void));
+uint32_t ILI9320_HAL_GetTicks(void);
+uint32_t ILI9320_HAL_TickFreq(void);
 
 #endif /* INC_ILI9320_HAL_H_ */
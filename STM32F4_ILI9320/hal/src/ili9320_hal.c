@@ -24,9 +24,43 @@
 #define ILI9320_RST_PIN   GPIO_Pin_4            ///< Reset pin
 #define ILI9320_RST_CLK   RCC_AHB1Periph_GPIOB  ///< Clock for reset pin
 
+#define ILI9320_FMARK_PORT        GPIOB                 ///< GPIO for frame marker pin
+#define ILI9320_FMARK_PIN         GPIO_Pin_5            ///< Frame marker pin
+#define ILI9320_FMARK_CLK         RCC_AHB1Periph_GPIOB  ///< Clock for frame marker pin
+#define ILI9320_FMARK_PORT_SOURCE EXTI_PortSourceGPIOB  ///< EXTI port of frame marker pin
+#define ILI9320_FMARK_PIN_SOURCE  EXTI_PinSource5       ///< EXTI pin of frame marker pin
+#define ILI9320_FMARK_LINE        EXTI_Line5            ///< EXTI line of frame marker pin
+#define ILI9320_FMARK_IRQ         EXTI9_5_IRQn          ///< Frame marker interrupt
+
 #define ILI9320_REG       (*((volatile unsigned short *) 0x60000000)) ///< Address for writing register number
 #define ILI9320_DATA      (*((volatile unsigned short *) 0x60020000)) ///< Address for writing data
 
+#define ILI9320_DMA_STREAM    DMA2_Stream0          ///< Memory to memory transfers only work on DMA2
+#define ILI9320_DMA_CHANNEL   DMA_Channel_0         ///< DMA channel (any channel works for memory to memory)
+#define ILI9320_DMA_CLK       RCC_AHB1Periph_DMA2   ///< Clock for DMA
+#define ILI9320_DMA_IRQ       DMA2_Stream0_IRQn     ///< DMA stream interrupt
+#define ILI9320_DMA_FLAG_TC   DMA_FLAG_TCIF0        ///< Transfer complete flag
+#define ILI9320_DMA_FLAG_TE   DMA_FLAG_TEIF0        ///< Transfer error flag
+#define ILI9320_DMA_MAX_COUNT 0xffff                ///< Maximum number of data items in one DMA transfer
+
+static void ILI9320_HAL_DMAInit(void);
+static void ILI9320_HAL_DMAStart(uint32_t source, uint32_t len,
+    uint8_t increment, void (*cb)(void));
+static void ILI9320_HAL_DMANextChunk(void);
+
+static volatile uint8_t dmaBusy;       ///< Is a DMA transfer in progress?
+static volatile uint16_t dmaFillData;  ///< Source of data for fill transfers
+static uint32_t dmaSource;             ///< Source address of next chunk
+static uint32_t dmaRemaining;          ///< Data items left after current chunk
+static uint8_t dmaIncrement;           ///< Increment source address (buffer) or not (fill)
+static void (*dmaCallback)(void);      ///< Called after the transfer is complete
+static void (*fmarkCallback)(void);    ///< Called on every frame marker pulse
+
+/**
+ * @brief Waits until the bus is not used by DMA.
+ */
+#define ILI9320_HAL_DMAWait() do { while (dmaBusy); } while (0)
+
 
 /**
  * @brief Initialize ILI9320 hardware layer.
@@ -125,9 +159,11 @@ void ILI9320_HAL_HardInit(void) {
   FSMC_NORSRAMInitTypeDef  FSMC_NORSRAM_InitStructure;
   FSMC_NORSRAMTimingInitTypeDef FSMC_NORSRAM_Timing;
 
-  FSMC_NORSRAM_Timing.FSMC_AddressSetupTime       = 0x04;
+  // reads and writes have separate timings (extended mode), both are
+  // safe here - writes are made faster by ILI9320_CalibrateTiming()
+  FSMC_NORSRAM_Timing.FSMC_AddressSetupTime       = ILI9320_HAL_ADDRESS_SETUP;
   FSMC_NORSRAM_Timing.FSMC_AddressHoldTime        = 0x00;
-  FSMC_NORSRAM_Timing.FSMC_DataSetupTime          = 0x14;
+  FSMC_NORSRAM_Timing.FSMC_DataSetupTime          = ILI9320_HAL_DATA_SETUP;
   FSMC_NORSRAM_Timing.FSMC_BusTurnAroundDuration  = 0x00;
   FSMC_NORSRAM_Timing.FSMC_CLKDivision            = 0x00;
   FSMC_NORSRAM_Timing.FSMC_DataLatency            = 0x00;
@@ -143,7 +179,7 @@ void ILI9320_HAL_HardInit(void) {
   FSMC_NORSRAM_InitStructure.FSMC_WaitSignalActive      = FSMC_WaitSignalActive_BeforeWaitState;
   FSMC_NORSRAM_InitStructure.FSMC_WriteOperation        = FSMC_WriteOperation_Enable;
   FSMC_NORSRAM_InitStructure.FSMC_WaitSignal            = FSMC_WaitSignal_Disable;
-  FSMC_NORSRAM_InitStructure.FSMC_ExtendedMode          = FSMC_ExtendedMode_Disable;
+  FSMC_NORSRAM_InitStructure.FSMC_ExtendedMode          = FSMC_ExtendedMode_Enable;
   FSMC_NORSRAM_InitStructure.FSMC_WriteBurst            = FSMC_WriteBurst_Disable;
   FSMC_NORSRAM_InitStructure.FSMC_ReadWriteTimingStruct = &FSMC_NORSRAM_Timing;
   FSMC_NORSRAM_InitStructure.FSMC_WriteTimingStruct     = &FSMC_NORSRAM_Timing;
@@ -153,6 +189,179 @@ void ILI9320_HAL_HardInit(void) {
   /* Enable FSMC Bank1_SRAM Bank */
   FSMC_NORSRAMCmd(FSMC_Bank1_NORSRAM1, ENABLE);
 
+  ILI9320_HAL_DMAInit();
+
+  // cycle counter is the time base of frame synchronization
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+/**
+ * @brief Initializes DMA used for transfers to the LCD data address.
+ *
+ * @details DMA2 works in memory to memory mode. In this mode
+ * the peripheral address register holds the source and the memory
+ * address register holds the destination, which is always the fixed
+ * FSMC data address.
+ */
+static void ILI9320_HAL_DMAInit(void) {
+
+  RCC_AHB1PeriphClockCmd(ILI9320_DMA_CLK, ENABLE);
+
+  DMA_DeInit(ILI9320_DMA_STREAM);
+
+  NVIC_InitTypeDef NVIC_InitStructure;
+  NVIC_InitStructure.NVIC_IRQChannel = ILI9320_DMA_IRQ;
+  NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 1;
+  NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+  NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+  NVIC_Init(&NVIC_InitStructure);
+}
+/**
+ * @brief Starts a DMA transfer to the LCD data address.
+ * @param source Source address.
+ * @param len Number of 16 bit data items.
+ * @param increment 1 if the source is a buffer, 0 if it is a single value.
+ * @param cb Callback called after the transfer is complete (may be null).
+ */
+static void ILI9320_HAL_DMAStart(uint32_t source, uint32_t len,
+    uint8_t increment, void (*cb)(void)) {
+
+  DMA_InitTypeDef DMA_InitStructure;
+
+  dmaBusy       = 1;
+  dmaSource     = source;
+  dmaRemaining  = len;
+  dmaIncrement  = increment;
+  dmaCallback   = cb;
+
+  DMA_InitStructure.DMA_Channel             = ILI9320_DMA_CHANNEL;
+  DMA_InitStructure.DMA_PeripheralBaseAddr  = source;
+  DMA_InitStructure.DMA_Memory0BaseAddr     = (uint32_t)&ILI9320_DATA;
+  DMA_InitStructure.DMA_DIR                 = DMA_DIR_MemoryToMemory;
+  DMA_InitStructure.DMA_BufferSize          = 1; // set for every chunk
+  DMA_InitStructure.DMA_PeripheralInc       = increment ?
+      DMA_PeripheralInc_Enable : DMA_PeripheralInc_Disable;
+  DMA_InitStructure.DMA_MemoryInc           = DMA_MemoryInc_Disable;
+  DMA_InitStructure.DMA_PeripheralDataSize  = DMA_PeripheralDataSize_HalfWord;
+  DMA_InitStructure.DMA_MemoryDataSize      = DMA_MemoryDataSize_HalfWord;
+  DMA_InitStructure.DMA_Mode                = DMA_Mode_Normal;
+  DMA_InitStructure.DMA_Priority            = DMA_Priority_High;
+  DMA_InitStructure.DMA_FIFOMode            = DMA_FIFOMode_Enable; // no direct mode in M2M
+  DMA_InitStructure.DMA_FIFOThreshold       = DMA_FIFOThreshold_Full;
+  DMA_InitStructure.DMA_MemoryBurst         = DMA_MemoryBurst_Single;
+  DMA_InitStructure.DMA_PeripheralBurst     = DMA_PeripheralBurst_Single;
+  DMA_Init(ILI9320_DMA_STREAM, &DMA_InitStructure);
+
+  DMA_ITConfig(ILI9320_DMA_STREAM, DMA_IT_TC | DMA_IT_TE, ENABLE);
+
+  ILI9320_HAL_DMANextChunk();
+}
+/**
+ * @brief Starts the next chunk of a DMA transfer.
+ *
+ * @details A single DMA transfer can move at most 65535 items,
+ * so longer transfers (a whole screen is 76800 pixels) are split.
+ */
+static void ILI9320_HAL_DMANextChunk(void) {
+
+  uint32_t count = dmaRemaining;
+
+  if (count > ILI9320_DMA_MAX_COUNT) {
+    count = ILI9320_DMA_MAX_COUNT;
+  }
+
+  ILI9320_DMA_STREAM->PAR = dmaSource;
+  DMA_SetCurrDataCounter(ILI9320_DMA_STREAM, count);
+
+  dmaRemaining -= count;
+  if (dmaIncrement) {
+    dmaSource += count * sizeof(uint16_t);
+  }
+
+  DMA_Cmd(ILI9320_DMA_STREAM, ENABLE);
+}
+/**
+ * @brief Fills the currently selected register with data using DMA.
+ *
+ * @details The function returns immediately. All other HAL functions
+ * wait for the transfer to complete before using the bus.
+ *
+ * @param data Data to write.
+ * @param len Number of words.
+ * @param cb Callback called after the transfer is complete (may be null).
+ */
+void ILI9320_HAL_DMAFill(uint16_t data, uint32_t len, void (*cb)(void)) {
+
+  ILI9320_HAL_DMAWait();
+
+  if (len == 0) {
+    if (cb) {
+      cb();
+    }
+    return;
+  }
+
+  dmaFillData = data;
+  ILI9320_HAL_DMAStart((uint32_t)&dmaFillData, len, 0, cb);
+}
+/**
+ * @brief Writes a buffer to the currently selected register using DMA.
+ *
+ * @details The function returns immediately. The buffer has to stay
+ * valid until the transfer is complete.
+ *
+ * @param buf Data to write.
+ * @param len Number of words.
+ * @param cb Callback called after the transfer is complete (may be null).
+ */
+void ILI9320_HAL_DMAWrite(const uint16_t* buf, uint32_t len, void (*cb)(void)) {
+
+  ILI9320_HAL_DMAWait();
+
+  if (len == 0) {
+    if (cb) {
+      cb();
+    }
+    return;
+  }
+
+  ILI9320_HAL_DMAStart((uint32_t)buf, len, 1, cb);
+}
+/**
+ * @brief Checks if a DMA transfer is in progress.
+ * @retval 1 Transfer in progress
+ * @retval 0 DMA idle
+ */
+uint8_t ILI9320_HAL_DMABusy(void) {
+
+  return dmaBusy;
+}
+/**
+ * @brief IRQ handler for the LCD DMA stream.
+ */
+void DMA2_Stream0_IRQHandler(void) {
+
+  if (DMA_GetFlagStatus(ILI9320_DMA_STREAM, ILI9320_DMA_FLAG_TE) != RESET) {
+    DMA_ClearFlag(ILI9320_DMA_STREAM, ILI9320_DMA_FLAG_TE);
+    dmaRemaining = 0; // abort transfer
+  }
+
+  if (DMA_GetFlagStatus(ILI9320_DMA_STREAM, ILI9320_DMA_FLAG_TC) != RESET) {
+    DMA_ClearFlag(ILI9320_DMA_STREAM, ILI9320_DMA_FLAG_TC);
+
+    if (dmaRemaining) {
+      ILI9320_HAL_DMANextChunk();
+      return;
+    }
+  }
+
+  if (DMA_GetCmdStatus(ILI9320_DMA_STREAM) == DISABLE) {
+    dmaBusy = 0;
+    if (dmaCallback) {
+      dmaCallback();
+    }
+  }
 }
 
 /**
@@ -162,9 +371,105 @@ void ILI9320_HAL_HardInit(void) {
  */
 void ILI9320_HAL_WriteReg(uint16_t reg, uint16_t data) {
 
+  ILI9320_HAL_DMAWait();
   ILI9320_REG = reg;
   ILI9320_DATA = data;
 }
+/**
+ * @brief Selects a register without writing any data.
+ *
+ * @details Used before streaming data to the GRAM
+ * (register 0x22), so that the index is sent only once.
+ *
+ * @param reg Register address.
+ */
+void ILI9320_HAL_WriteIndex(uint16_t reg) {
+
+  ILI9320_HAL_DMAWait();
+  ILI9320_REG = reg;
+}
+/**
+ * @brief Writes a single data word to the currently selected register.
+ * @param data Data to write.
+ */
+void ILI9320_HAL_WriteData(uint16_t data) {
+
+  ILI9320_HAL_DMAWait();
+  ILI9320_DATA = data;
+}
+/**
+ * @brief Writes a buffer of data words to the currently selected register.
+ * @param buf Data to write.
+ * @param len Number of words.
+ */
+void ILI9320_HAL_WriteDataBuffer(const uint16_t* buf, uint32_t len) {
+
+  ILI9320_HAL_DMAWait();
+
+  // unrolled - every iteration is just a bus write
+  while (len >= 4) {
+    ILI9320_DATA = buf[0];
+    ILI9320_DATA = buf[1];
+    ILI9320_DATA = buf[2];
+    ILI9320_DATA = buf[3];
+    buf += 4;
+    len -= 4;
+  }
+  while (len--) {
+    ILI9320_DATA = *buf++;
+  }
+}
+/**
+ * @brief Writes the same data word len times to the currently selected register.
+ * @param data Data to write.
+ * @param len Number of words.
+ */
+void ILI9320_HAL_FillData(uint16_t data, uint32_t len) {
+
+  ILI9320_HAL_DMAWait();
+
+  while (len >= 4) {
+    ILI9320_DATA = data;
+    ILI9320_DATA = data;
+    ILI9320_DATA = data;
+    ILI9320_DATA = data;
+    len -= 4;
+  }
+  while (len--) {
+    ILI9320_DATA = data;
+  }
+}
+/**
+ * @brief Reads data from the selected register.
+ * @return Data read.
+ */
+uint16_t ILI9320_HAL_ReadData(void) {
+
+  ILI9320_HAL_DMAWait();
+  return ILI9320_DATA;
+}
+/**
+ * @brief Reads len words from the selected register.
+ * @param buf Buffer for data.
+ * @param len Number of words.
+ */
+void ILI9320_HAL_ReadDataBuffer(uint16_t* buf, uint32_t len) {
+
+  ILI9320_HAL_DMAWait();
+
+  // unrolled - every iteration is just a bus read
+  while (len >= 4) {
+    buf[0] = ILI9320_DATA;
+    buf[1] = ILI9320_DATA;
+    buf[2] = ILI9320_DATA;
+    buf[3] = ILI9320_DATA;
+    buf += 4;
+    len -= 4;
+  }
+  while (len--) {
+    *buf++ = ILI9320_DATA;
+  }
+}
 /**
  * @brief Function for reading a given register.
  * @param reg Register address.
@@ -172,6 +477,7 @@ void ILI9320_HAL_WriteReg(uint16_t reg, uint16_t data) {
  */
 uint16_t ILI9320_HAL_ReadReg(uint16_t reg) {
 
+  ILI9320_HAL_DMAWait();
   ILI9320_REG = reg;
   return ILI9320_DATA;
 }
@@ -188,3 +494,79 @@ void ILI9320_HAL_ResetOn(void) {
 void ILI9320_HAL_ResetOff(void) {
   GPIO_SetBits(ILI9320_RST_PORT, ILI9320_RST_PIN);
 }
+/**
+ * @brief Changes the write timing of the FSMC (reads are not changed).
+ * @param addressSetup Address setup time (HCLK cycles, 0-15)
+ * @param dataSetup Data setup time (HCLK cycles, 1-255)
+ */
+void ILI9320_HAL_SetWriteTiming(uint8_t addressSetup, uint8_t dataSetup) {
+
+  ILI9320_HAL_DMAWait();
+
+  // write timing register of bank 1 (used in extended mode)
+  FSMC_Bank1E->BWTR[0] = (addressSetup & 0x0f) |
+      ((uint32_t)dataSetup << 8) | FSMC_AccessMode_B;
+}
+/**
+ * @brief Initialize the frame marker (FMARK) signal and interrupt.
+ * @param cb Callback function called on every FMARK pulse.
+ */
+void ILI9320_HAL_FmarkInit(void (*cb)(void)) {
+
+  GPIO_InitTypeDef GPIO_InitStructure;
+  EXTI_InitTypeDef EXTI_InitStructure;
+  NVIC_InitTypeDef NVIC_InitStructure;
+
+  fmarkCallback = cb;
+
+  RCC_AHB1PeriphClockCmd(ILI9320_FMARK_CLK, ENABLE);
+  RCC_APB2PeriphClockCmd(RCC_APB2Periph_SYSCFG, ENABLE);
+
+  GPIO_InitStructure.GPIO_Pin = ILI9320_FMARK_PIN;
+  GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IN;
+  GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_DOWN;
+  GPIO_Init(ILI9320_FMARK_PORT, &GPIO_InitStructure);
+
+  SYSCFG_EXTILineConfig(ILI9320_FMARK_PORT_SOURCE, ILI9320_FMARK_PIN_SOURCE);
+
+  EXTI_InitStructure.EXTI_Line = ILI9320_FMARK_LINE;
+  EXTI_InitStructure.EXTI_Mode = EXTI_Mode_Interrupt;
+  EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Rising;
+  EXTI_InitStructure.EXTI_LineCmd = ENABLE;
+  EXTI_Init(&EXTI_InitStructure);
+
+  // the pulse is timestamped, so it has the highest priority
+  NVIC_InitStructure.NVIC_IRQChannel = ILI9320_FMARK_IRQ;
+  NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0x00;
+  NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0x00;
+  NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+  NVIC_Init(&NVIC_InitStructure);
+}
+/**
+ * @brief Returns the time base of frame synchronization.
+ * @return Core clock cycle counter.
+ */
+uint32_t ILI9320_HAL_GetTicks(void) {
+
+  return DWT->CYCCNT;
+}
+/**
+ * @brief Returns the frequency of ILI9320_HAL_GetTicks().
+ * @return Ticks per second.
+ */
+uint32_t ILI9320_HAL_TickFreq(void) {
+
+  return SystemCoreClock;
+}
+/**
+ * @brief Handler for FMARK interrupt.
+ */
+void EXTI9_5_IRQHandler(void) {
+
+  if (EXTI_GetITStatus(ILI9320_FMARK_LINE) != RESET) {
+    EXTI_ClearITPendingBit(ILI9320_FMARK_LINE);
+    if (fmarkCallback) {
+      fmarkCallback();
+    }
+  }
+}
@@ -0,0 +1,661 @@
+/**
+ * @file    bench.c
+ * @brief   Measures bus traffic of the graphics library on the simulated LCD.
+ * @date    16 paź 2026
+ * @author  agent
+ *
+ * @details Every drawing function is run on the simulated ILI9320
+ * and the number of bus cycles it generated is printed. The final
+ * screen can be saved as a PPM file:
+ *
+ *   ./bench [screen.ppm]
+ *
+ * @verbatim
+ * Copyright (c) 2026 agent.
+ * All rights reserved. This program and the
+ * accompanying materials are made available
+ * under the terms of the GNU Public License
+ * v3.0 which accompanies this distribution,
+ * and is available at
+ * http://www.gnu.org/licenses/gpl.html
+ * @endverbatim
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <graphics.h>
+#include <font_8x16.h>
+#include <font_21x39.h>
+#include <glyph_cache.h>
+#include <framebuffer.h>
+#include <dirty.h>
+#include <strip.h>
+#include <ili9320_sim.h>
+#include <disk_sim.h>
+#include <fat.h>
+#include <example_bmp.h>
+
+/**
+ * @addtogroup ILI9320_SIM
+ * @{
+ */
+
+static uint8_t graphData[320]; ///< Data for example graph - sinusoidal signal
+static uint8_t frame[FB_SIZE]; ///< Off-screen framebuffer
+static uint8_t gradient[64][256][3]; ///< RGB888 test image
+static uint16_t decoded[192 * 256];  ///< Example image read back from the LCD
+static uint8_t icon[64][32];         ///< 4 bit indexed test icon
+static GRAPH_Color iconPalette[16];  ///< Colors of test icon
+static uint8_t bmp24[54 + 48 * 32 * 3];          ///< 24 bit bottom-up BMP file
+static uint8_t bmp8[54 + 16 * 4 + 40 * 24];      ///< 8 bit top-down BMP file
+static int failures;                 ///< Number of failed pixel checks
+
+/**
+ * @brief Baseline JPEG file (32x32, 4:2:0) with four flat quadrants.
+ */
+static const uint8_t quadJpeg[] = {
+    0xff, 0xd8, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x03, 0x02, 0x02, 0x03, 0x02,
+    0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x04, 0x05, 0x08, 0x05,
+    0x05, 0x04, 0x04, 0x05, 0x0a, 0x07, 0x07, 0x06, 0x08, 0x0c, 0x0a, 0x0c,
+    0x0c, 0x0b, 0x0a, 0x0b, 0x0b, 0x0d, 0x0e, 0x12, 0x10, 0x0d, 0x0e, 0x11,
+    0x0e, 0x0b, 0x0b, 0x10, 0x16, 0x10, 0x11, 0x13, 0x14, 0x15, 0x15, 0x15,
+    0x0c, 0x0f, 0x17, 0x18, 0x16, 0x14, 0x18, 0x12, 0x14, 0x15, 0x14, 0xff,
+    0xdb, 0x00, 0x43, 0x01, 0x03, 0x04, 0x04, 0x05, 0x04, 0x05, 0x09, 0x05,
+    0x05, 0x09, 0x14, 0x0d, 0x0b, 0x0d, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xff, 0xc0, 0x00, 0x11,
+    0x08, 0x00, 0x20, 0x00, 0x20, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01,
+    0x03, 0x11, 0x01, 0xff, 0xc4, 0x00, 0x17, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x08, 0x09, 0xff, 0xc4, 0x00, 0x14, 0x10, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xc4, 0x00, 0x17, 0x01, 0x00, 0x03, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0x07, 0x09, 0x08, 0xff, 0xc4, 0x00, 0x14, 0x11, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11,
+    0x00, 0x3f, 0x00, 0x92, 0x00, 0x57, 0xb7, 0x82, 0xe0, 0x00, 0x71, 0x15,
+    0xd9, 0x54, 0x05, 0x50, 0x3e, 0xdd, 0x60, 0x01, 0x0e, 0x8f, 0x07, 0xff,
+    0xd9,
+};
+
+/**
+ * @brief Colors of the quadrants of the JPEG file (R, G, B).
+ */
+static const uint8_t quadColors[4][3] = {
+    {220, 40, 40}, {40, 200, 60}, // top left, top right
+    {40, 60, 220}, {230, 220, 50} // bottom left, bottom right
+};
+
+/**
+ * @brief Gradient drawn as an RGB888 image.
+ */
+static const GRAPH_ImageStruct gradientImage = {
+    gradient, 64, 256, GRAPH_IMAGE_RGB888, 0, 0, 0
+};
+
+/**
+ * @brief Example image decoded to RGB565.
+ */
+static GRAPH_ImageStruct decodedImage = {
+    decoded, 192, 256, GRAPH_IMAGE_RGB565, 0, 0, 0
+};
+
+/**
+ * @brief Round icon - index 0 around it is transparent.
+ */
+static const GRAPH_ImageStruct iconImage = {
+    icon, 64, 64, GRAPH_IMAGE_INDEX4, iconPalette, 1, 0
+};
+
+/**
+ * @brief The same icon drawn with its background.
+ */
+static const GRAPH_ImageStruct iconOpaqueImage = {
+    icon, 64, 64, GRAPH_IMAGE_INDEX4, iconPalette, 0, 0
+};
+
+/**
+ * @brief Prints bus cycles used by the last measured function.
+ *
+ * @details The last column is the number of register and index
+ * writes skipped by the register shadow of the driver.
+ *
+ * @param name Name of measured function.
+ */
+static void BENCH_Report(const char* name) {
+
+  ILI9320_SIM_Stats s;
+  ILI9320_RegStats r;
+  ILI9320_SIM_GetStats(&s);
+  ILI9320_GetRegStats(&r);
+
+  printf("%-28s %10u %10u %10u %10u %10u %10u\n", name,
+      s.indexCycles, s.regCycles, s.gramCycles, s.readCycles,
+      ILI9320_SIM_BusCycles(), r.regElided + r.indexElided);
+
+  ILI9320_SIM_ResetStats();
+  ILI9320_ResetRegStats();
+}
+/**
+ * @brief Hides the output of the FAT module.
+ *
+ * @details The FAT module prints debug messages on every read,
+ * which would bury the results.
+ *
+ * @param quiet 1 - discard the standard output, 0 - restore it.
+ */
+static void BENCH_Quiet(int quiet) {
+
+  static int saved = -1;
+
+  fflush(stdout);
+  if (quiet) {
+    const int null = open("/dev/null", O_WRONLY);
+    saved = dup(STDOUT_FILENO);
+    dup2(null, STDOUT_FILENO);
+    close(null);
+  } else if (saved >= 0) {
+    dup2(saved, STDOUT_FILENO);
+    close(saved);
+    saved = -1;
+  }
+}
+/**
+ * @brief Color of a pixel of the 24 bit test BMP.
+ * @param x X coordinate in image
+ * @param y Y coordinate in image
+ * @param rgb Red, green and blue components
+ */
+static void BENCH_BmpColor(int x, int y, uint8_t* rgb) {
+
+  rgb[0] = 5 * x;
+  rgb[1] = 8 * y;
+  rgb[2] = 255 - 3 * (x + y);
+}
+/**
+ * @brief Builds the test BMP files.
+ *
+ * @details The 24 bit file is stored bottom-up with rows padded
+ * to 4 bytes, the 8 bit one top-down with a 16 color palette.
+ */
+static void BENCH_MakeBmp(void) {
+
+  uint8_t* p;
+
+  p = bmp24;
+  p[0] = 'B';
+  p[1] = 'M';
+  p[10] = 54;                 // data offset
+  p[14] = 40;                 // info header size
+  p[18] = 48;                 // width
+  p[22] = 32;                 // height - bottom-up
+  p[26] = 1;                  // planes
+  p[28] = 24;                 // bits per pixel
+  p = bmp24 + 54;
+  for (int y = 31; y >= 0; y--) {
+    for (int x = 0; x < 48; x++, p += 3) {
+      uint8_t rgb[3];
+      BENCH_BmpColor(x, y, rgb);
+      p[0] = rgb[2];
+      p[1] = rgb[1];
+      p[2] = rgb[0];
+    }
+  }
+
+  p = bmp8;
+  p[0] = 'B';
+  p[1] = 'M';
+  p[10] = 54 + 16 * 4;
+  p[14] = 40;
+  p[18] = 40;
+  p[22] = -24;                // height - top-down
+  p[23] = p[24] = p[25] = 0xff;
+  p[26] = 1;
+  p[28] = 8;
+  p[46] = 16;                 // colors in palette
+  for (int i = 0; i < 16; i++) {
+    p = bmp8 + 54 + 4 * i;    // B, G, R, 0
+    p[0] = 8 * i;
+    p[1] = 255 - 16 * i;
+    p[2] = 16 * i;
+  }
+  p = bmp8 + 54 + 16 * 4;
+  for (int y = 0; y < 24; y++) {
+    for (int x = 0; x < 40; x++) {
+      *p++ = (x / 5 + y / 3) & 15;
+    }
+  }
+}
+/**
+ * @brief Compares the screen with a test BMP.
+ *
+ * @details Only the visible part of the image is compared.
+ * Differences are counted in failures.
+ *
+ * @param bits Bits per pixel of the test BMP (24 or 8)
+ * @param x0 X coordinate the image was drawn at
+ * @param y0 Y coordinate the image was drawn at
+ */
+static void BENCH_CheckBmp(int bits, int x0, int y0) {
+
+  const int w = (bits == 24) ? 48 : 40;
+  const int h = (bits == 24) ? 32 : 24;
+  int errors = 0;
+  GRAPH_Color c;
+  uint8_t rgb[3];
+
+  for (int y = 0; y < h && y0 + y < ILI9320_HEIGHT; y++) {
+    for (int x = 0; x < w && x0 + x < ILI9320_WIDTH; x++) {
+      if (bits == 24) {
+        BENCH_BmpColor(x, y, rgb);
+      } else {
+        const int i = (x / 5 + y / 3) & 15;
+        rgb[0] = 16 * i;
+        rgb[1] = 255 - 16 * i;
+        rgb[2] = 8 * i;
+      }
+      c = GRAPH_RGB(rgb[0], rgb[1], rgb[2]);
+      if (ILI9320_SIM_GetPixel(x0 + x, y0 + y) != c) {
+        errors++;
+      }
+    }
+  }
+
+  if (errors) {
+    printf("  %d pixels differ\n", errors);
+    failures++;
+  }
+}
+/**
+ * @brief Compares the screen with the test JPEG.
+ *
+ * @details The middle pixel of every quadrant is compared with its
+ * color, with a margin for the lossy compression and RGB565. The
+ * pixel right of the image has to stay black, as it was before.
+ * Differences are counted in failures.
+ *
+ * @param x0 X coordinate the image was drawn at
+ * @param y0 Y coordinate the image was drawn at
+ * @param scale Scale the image was drawn with
+ */
+static void BENCH_CheckJpeg(int x0, int y0, int scale) {
+
+  const int size = 32 / scale;
+  int errors = 0;
+  GRAPH_Color c;
+
+  for (int q = 0; q < 4; q++) {
+    c = ILI9320_SIM_GetPixel(x0 + (q & 1) * size / 2 + size / 4,
+        y0 + (q >> 1) * size / 2 + size / 4);
+    const int rgb[3] = {(c >> 11) << 3, ((c >> 5) & 0x3f) << 2, (c & 0x1f) << 3};
+    for (int i = 0; i < 3; i++) {
+      if (abs(rgb[i] - quadColors[q][i]) > 12) {
+        errors++;
+      }
+    }
+  }
+  if (ILI9320_SIM_GetPixel(x0 + size, y0) != 0) {
+    errors++;
+  }
+
+  if (errors) {
+    printf("  %d components differ\n", errors);
+    failures++;
+  }
+}
+/**
+ * @brief Prints the time and tearing since the previous call.
+ */
+static void BENCH_Tearing(void) {
+
+  static uint32_t time;
+  ILI9320_SIM_Stats s;
+
+  ILI9320_SIM_GetStats(&s);
+  printf("  %u us, %u writes to the scanned line\n",
+      ILI9320_SIM_GetTimeUS() - time, s.scanWrites);
+  time = ILI9320_SIM_GetTimeUS();
+}
+/**
+ * @brief Benchmark main function.
+ * @param argc Number of arguments.
+ * @param argv Arguments - optional name of PPM file.
+ * @return 0 on success, 1 when a drawn image differs from the expected one.
+ */
+int main(int argc, char** argv) {
+
+  double x = 0.0;
+
+  for (int i = 0; i < 320; i++, x += 0.01*M_PI) {
+    graphData[i] = (uint8_t)(sin(x)*100 + 100);
+  }
+  for (int i = 0; i < 64; i++) {
+    for (int j = 0; j < 256; j++) {
+      gradient[i][j][0] = j;
+      gradient[i][j][1] = 4 * i;
+      gradient[i][j][2] = 255 - j;
+    }
+  }
+  for (int i = 0; i < 16; i++) {
+    iconPalette[i] = GRAPH_RGB(16 * i, 255 - 16 * i, 128);
+  }
+  for (int i = 0; i < 64; i++) {
+    for (int j = 0; j < 64; j++) {
+      const int d = (i - 32) * (i - 32) + (j - 32) * (j - 32);
+      const int index = (d < 32 * 32) ? 1 + d / 74 : 0;
+      icon[i][j / 2] |= (j & 1) ? index : index << 4;
+    }
+  }
+
+  printf("%-28s %10s %10s %10s %10s %10s %10s\n", "function",
+      "index", "register", "GRAM", "read", "total", "elided");
+
+  GRAPH_Init();
+  BENCH_Report("GRAPH_Init");
+
+  GRAPH_ClrScreen(0, 0, 0);
+  BENCH_Report("GRAPH_ClrScreen");
+
+  GRAPH_SetColor(0x00, 0x00, 0xff);
+  GRAPH_SetBgColor(0xff, 0x00, 0x00);
+
+  GRAPH_DrawRectangle(10, 10, 100, 50);
+  BENCH_Report("GRAPH_DrawRectangle 100x50");
+
+  GRAPH_DrawBox(100, 100, 100, 100, 5);
+  BENCH_Report("GRAPH_DrawBox 100x100");
+
+  GRAPH_DrawLine(0, 0, 319, 100);
+  BENCH_Report("GRAPH_DrawLine 320 px");
+
+  GRAPH_DrawCircle(160, 120, 50);
+  BENCH_Report("GRAPH_DrawCircle r=50");
+
+  GRAPH_DrawCircle(300, 220, 50); // three quarters outside of screen
+  BENCH_Report("GRAPH_DrawCircle at edge");
+
+  GRAPH_PushViewport(100, 60, 120, 120);
+  GRAPH_DrawImage(&example_bmpImage, 0, 0);
+  GRAPH_DrawLine(0, 0, 300, 200);
+  GRAPH_PopViewport();
+  BENCH_Report("Viewport 120x120");
+
+  GRAPH_DrawFilledCircle(50, 50, 50);
+  BENCH_Report("GRAPH_DrawFilledCircle r=50");
+
+  GRAPH_DrawFilledEllipse(160, 120, 80, 40);
+  BENCH_Report("GRAPH_DrawFilledEllipse 80x40");
+
+  GRAPH_DrawRoundedRectangle(200, 20, 100, 40, 8);
+  BENCH_Report("GRAPH_DrawRoundedRectangle");
+
+  GRAPH_DrawRoundedBox(200, 70, 100, 40, 8);
+  BENCH_Report("GRAPH_DrawRoundedBox");
+
+  GRAPH_DrawThickLine(0, 0, 319, 239, 5);
+  BENCH_Report("GRAPH_DrawThickLine w=5");
+
+  {
+    static const GRAPH_PointStruct zigzag[] = {
+        {20, 20}, {150, 60}, {60, 200}, {300, 120}, {310, 10}};
+    GRAPH_DrawPolyline(zigzag, 5, 3);
+  }
+  BENCH_Report("GRAPH_DrawPolyline 4x w=3");
+
+  GRAPH_DrawFilledTriangle(160, 120, 60, 40, 170, 110);
+  BENCH_Report("GRAPH_DrawFilledTriangle");
+
+  {
+    static const GRAPH_PointStruct needle[] = {
+        {160, 120}, {168, 112}, {300, 20}, {152, 128}};
+    GRAPH_DrawFilledPolygon(needle, 4);
+  }
+  BENCH_Report("GRAPH_DrawFilledPolygon 4pt");
+
+  GRAPH_SetColor(0xff, 0xff, 0xff);
+  GRAPH_SetFont(font21x39Info);
+  GRAPH_DrawChar('A', 120, 50);
+  BENCH_Report("GRAPH_DrawChar 21x39");
+
+  GRAPH_DrawString("Hello World", 200, 0);
+  BENCH_Report("GRAPH_DrawString 21x39 x11");
+
+  GRAPH_SetFont(font8x16Info);
+  GRAPH_DrawString("To be or not to be", 170, 0);
+  BENCH_Report("GRAPH_DrawString 8x16 x18");
+
+  GRAPH_DrawString("0123456789", 150, 0);
+  BENCH_Report("GRAPH_DrawString digits");
+
+  GRAPH_DrawString("9876543210", 150, 0);
+  BENCH_Report("GRAPH_DrawString digits (2)");
+
+  const uint32_t decodeStart = ILI9320_SIM_GetTimeUS();
+  GRAPH_DrawImage(&example_bmpImage, 30, 30);
+  const uint32_t decodeTime = ILI9320_SIM_GetTimeUS() - decodeStart;
+  BENCH_Report("GRAPH_DrawImage RLE8 256x192");
+  printf("  %u bytes (RGB565: %u bytes), ratio %.2f, %u us, %u pixels/s\n",
+      (unsigned)(sizeof(example_bmp) + sizeof(example_bmp_palette)),
+      (unsigned)sizeof(decoded),
+      (double)sizeof(decoded) /
+      (sizeof(example_bmp) + sizeof(example_bmp_palette)),
+      decodeTime, (unsigned)(192 * 256 * 1000000ULL / decodeTime));
+
+  // the same image sent as it is
+  ILI9320_ReadPixels(30, 30, 256, 192, decoded);
+  ILI9320_SIM_ResetStats();
+  ILI9320_ResetRegStats();
+  GRAPH_DrawImage(&decodedImage, 30, 30);
+  BENCH_Report("GRAPH_DrawImage RGB565");
+
+  GRAPH_DrawImage(&gradientImage, 30, 30);
+  BENCH_Report("GRAPH_DrawImage RGB888");
+
+  GRAPH_SetDither(1);
+  GRAPH_DrawImage(&gradientImage, 30, 30);
+  GRAPH_SetDither(0);
+  BENCH_Report("GRAPH_DrawImage dithered");
+
+  GRAPH_DrawImage(&iconOpaqueImage, 30, 30);
+  BENCH_Report("GRAPH_DrawImage INDEX4 64x64");
+
+  GRAPH_DrawImage(&iconImage, 100, 30);
+  BENCH_Report("GRAPH_DrawImage transparent");
+
+  // BMP and JPEG files read from the simulated SD card
+  BENCH_MakeBmp();
+  DISK_SIM_Format();
+  DISK_SIM_AddFile("TEST24  BMP", bmp24, sizeof(bmp24));
+  DISK_SIM_AddFile("TEST8   BMP", bmp8, sizeof(bmp8));
+  DISK_SIM_AddFile("QUAD    JPG", quadJpeg, sizeof(quadJpeg));
+  BENCH_Quiet(1);
+  if (FAT_Init(DISK_SIM_Init, DISK_SIM_Read, DISK_SIM_Write)) {
+    failures++;
+  }
+  BENCH_Quiet(0);
+  ILI9320_SIM_ResetStats();
+  ILI9320_ResetRegStats();
+
+  BENCH_Quiet(1);
+  if (GRAPH_DrawBmpFile("TEST24  BMP", 200, 150)) {
+    failures++;
+  }
+  BENCH_Quiet(0);
+  BENCH_Report("GRAPH_DrawBmpFile 24 bit");
+  BENCH_CheckBmp(24, 200, 150);
+
+  BENCH_Quiet(1);
+  if (GRAPH_DrawBmpFile("TEST8   BMP", 290, 220)) { // clipped
+    failures++;
+  }
+  BENCH_Quiet(0);
+  BENCH_Report("GRAPH_DrawBmpFile 8 bit");
+  BENCH_CheckBmp(8, 290, 220);
+
+  GRAPH_SetColor(0, 0, 0);
+  GRAPH_DrawRectangle(200, 190, 80, 40);
+  ILI9320_SIM_ResetStats();
+  ILI9320_ResetRegStats();
+  BENCH_Quiet(1);
+  if (GRAPH_DrawJpegFile("QUAD    JPG", 200, 190, 1)) {
+    failures++;
+  }
+  BENCH_Quiet(0);
+  BENCH_Report("GRAPH_DrawJpegFile 32x32");
+  BENCH_CheckJpeg(200, 190, 1);
+
+  BENCH_Quiet(1);
+  if (GRAPH_DrawJpegFile("QUAD    JPG", 240, 190, 8)) {
+    failures++;
+  }
+  BENCH_Quiet(0);
+  BENCH_Report("GRAPH_DrawJpegFile 1/8");
+  BENCH_CheckJpeg(240, 190, 8);
+
+  GRAPH_DrawGraph(graphData, 290, 0, 0);
+  BENCH_Report("GRAPH_DrawGraph 290 points");
+
+  GRAPH_DrawBarChart(graphData+30, 32, 0, 0, 5);
+  BENCH_Report("GRAPH_DrawBarChart 32 bars");
+
+  GRAPH_SetFramebuffer(frame);
+  GRAPH_SetBgColor(0, 0, 0);
+  GRAPH_SetColor(0, 255, 0);
+  GRAPH_DrawGraph(graphData, 290, 0, 0);
+  GRAPH_DrawBarChart(graphData+30, 32, 0, 0, 5);
+  BENCH_Report("Framebuffer graph and bars");
+  GRAPH_Flush();
+  BENCH_Report("GRAPH_Flush");
+
+  // change a few bars and redraw only them
+  DIRTY_SetRedraw(FB_FlushRect);
+  for (int i = 0; i < 6; i++) {
+    GRAPH_SetColor(255, 0, 255);
+    GRAPH_DrawRectangle(100 + i * 10, 150, 5, 40);
+    DIRTY_Invalidate(100 + i * 10, 150, 5, 40);
+  }
+  GRAPH_DrawRectangle(10, 10, 20, 20);
+  DIRTY_Invalidate(10, 10, 20, 20);
+  GRAPH_DrawRectangle(15, 15, 20, 20);
+  DIRTY_Invalidate(15, 15, 20, 20);
+  DIRTY_Flush();
+  BENCH_Report("DIRTY_Flush 8 rects");
+  GRAPH_SetFramebuffer(0);
+
+  DIRTY_Stats dirty;
+  DIRTY_GetStats(&dirty);
+  printf("Dirty rectangles: %u invalidated (%u px), %u redrawn (%u px), "
+      "%u merges\n", dirty.rectsInvalidated, dirty.invalidatedPixels,
+      dirty.rectsRedrawn, dirty.redrawnPixels, dirty.merges);
+
+  // overlapping scene rendered band by band
+  STRIP_Clear(0, 0, 64);
+  STRIP_AddImage(&example_bmpImage, 30, 30);
+  STRIP_SetColor(255, 255, 0);
+  STRIP_AddRect(20, 100, 200, 60);
+  STRIP_SetColor(0, 255, 255);
+  STRIP_AddCircle(160, 120, 100);
+  STRIP_AddLine(0, 0, 319, 239);
+  STRIP_SetColor(255, 255, 255);
+  STRIP_SetBgColor(0, 0, 0);
+  STRIP_SetFont(&font8x16Info);
+  STRIP_AddString("Band renderer", 240, 20);
+  STRIP_Render();
+  BENCH_Report("STRIP_Render 9 entries");
+
+  // header and footer pinned - only the lines between them are rendered
+  GRAPH_PinRegion(0, 0, 48);
+  GRAPH_PinRegion(1, ILI9320_WIDTH - 48, 48);
+  STRIP_Render();
+  BENCH_Report("STRIP_Render 96 lines pinned");
+
+  // only the lines between them scroll - the pinned ones are moved along
+  for (int i = 0; i < 10; i++) {
+    GRAPH_Scroll(1);
+  }
+  BENCH_Report("GRAPH_Scroll 10 lines, 96 pinned");
+  GRAPH_UnpinRegion(0);
+  GRAPH_UnpinRegion(1);
+
+  // strip chart - every new sample scrolls the screen by one line
+  GRAPH_SetBgColor(0, 0, 0);
+  GRAPH_SetColor(0, 255, 0);
+  for (int i = 0; i < 100; i++) {
+    GRAPH_Scroll(1);
+    GRAPH_DrawRectangle(ILI9320_WIDTH - 1, graphData[i], 1, 3);
+  }
+  BENCH_Report("GRAPH_Scroll 100 samples");
+
+  // translucent popup - the screen is read, blended and written back
+  static uint16_t popup[64 * 64];
+  const uint32_t popupStart = ILI9320_SIM_GetTimeUS();
+  ILI9320_ReadPixels(128, 88, 64, 64, popup);
+  for (int i = 0; i < 64 * 64; i++) {
+    // half of every component, plus half of white
+    popup[i] = ((popup[i] >> 1) & 0x7bef) + 0x7bef;
+  }
+  ILI9320_WriteBegin(128, 88, 64, 64);
+  ILI9320_WritePixels(popup, 64 * 64);
+  ILI9320_WriteEnd();
+  printf("  %u us\n", ILI9320_SIM_GetTimeUS() - popupStart);
+  BENCH_Report("Popup blended 64x64");
+
+  // whole framebuffer sent while the panel scans the screen
+  GRAPH_SetFramebuffer(frame);
+  GRAPH_SetFramebuffer(0);
+  BENCH_Tearing();
+  FB_FlushRect(0, 0, FB_WIDTH, FB_HEIGHT);
+  BENCH_Tearing();
+  BENCH_Report("FB_FlushRect unsynchronized");
+
+  // the same sent right behind the scan line
+  if (ILI9320_VsyncInit(1)) {
+    printf("No FMARK\n");
+  }
+  BENCH_Tearing();
+  FB_FlushRect(0, 0, FB_WIDTH, FB_HEIGHT);
+  BENCH_Tearing();
+  BENCH_Report("FB_FlushRect behind scan");
+
+  // animation at half the frame rate
+  uint32_t dropped = 0;
+  const uint32_t firstFrame = ILI9320_GetFrame();
+  ILI9320_WaitFrame(1);
+  for (int i = 0; i < 10; i++) {
+    dropped += ILI9320_WaitFrame(2);
+    FB_FlushRect(100 + i * 4, 100, 40, 40);
+  }
+  printf("10 steps every 2 frames: %u frames, %u dropped, "
+      "frame period %u us\n", ILI9320_GetFrame() - firstFrame, dropped,
+      ILI9320_GetFramePeriod());
+  BENCH_Report("ILI9320_WaitFrame 10 steps");
+  ILI9320_VsyncInit(0);
+
+  uint32_t hits, misses;
+  GLYPH_CacheGetStats(&hits, &misses);
+  printf("Glyph cache: %u hits, %u misses\n", hits, misses);
+
+  if (argc > 1) {
+    if (ILI9320_SIM_DumpPPM(argv[1])) {
+      printf("Cannot write %s\n", argv[1]);
+      return 1;
+    }
+  }
+
+  if (failures) {
+    printf("%d image checks failed\n", failures);
+    return 1;
+  }
+
+  return 0;
+}
+
+/**
+ * @}
+ */
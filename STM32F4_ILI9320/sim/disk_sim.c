@@ -0,0 +1,208 @@
+/**
+ * @file    disk_sim.c
+ * @brief   Host side RAM disk with a FAT32 partition.
+ * @date    16 paź 2026
+ * @author  agent
+ *
+ * @details The disk is a small array of sectors which replaces
+ * the SD card. It holds one FAT32 partition with one sector per
+ * cluster. Files are added to the root directory in contiguous
+ * clusters, before the disk is mounted with FAT_Init():
+ *
+ *   DISK_SIM_Format();
+ *   DISK_SIM_AddFile("IMAGE   BMP", data, size);
+ *   FAT_Init(DISK_SIM_Init, DISK_SIM_Read, DISK_SIM_Write);
+ *
+ * @verbatim
+ * Copyright (c) 2026 agent.
+ * All rights reserved. This program and the
+ * accompanying materials are made available
+ * under the terms of the GNU Public License
+ * v3.0 which accompanies this distribution,
+ * and is available at
+ * http://www.gnu.org/licenses/gpl.html
+ * @endverbatim
+ */
+
+#include <string.h>
+#include <disk_sim.h>
+
+/**
+ * @addtogroup ILI9320_SIM
+ * @{
+ */
+
+#define DISK_SIM_SECTORS    256 ///< Size of the disk in sectors
+#define DISK_SIM_PARTITION  8   ///< First sector of the partition
+#define DISK_SIM_RESERVED   32  ///< Reserved sectors of the partition
+#define DISK_SIM_FAT_SIZE   2   ///< Sectors of one FAT (256 clusters)
+/**
+ * @brief First sector of the data area (cluster 2).
+ */
+#define DISK_SIM_DATA (DISK_SIM_PARTITION + DISK_SIM_RESERVED + 2 * DISK_SIM_FAT_SIZE)
+
+static uint8_t disk[DISK_SIM_SECTORS][512]; ///< Sectors of the disk
+static uint32_t nextCluster;                ///< First free cluster
+static uint32_t rootEntries;                ///< Used entries of the root directory
+
+static void DISK_SIM_Put16(uint8_t* p, uint16_t val);
+static void DISK_SIM_Put32(uint8_t* p, uint32_t val);
+static void DISK_SIM_SetFat(uint32_t cluster, uint32_t val);
+
+/**
+ * @brief Creates an empty FAT32 partition.
+ *
+ * @details The root directory takes cluster 2 and holds only
+ * the volume label.
+ */
+void DISK_SIM_Format(void) {
+
+  uint8_t* p;
+
+  memset(disk, 0, sizeof(disk));
+
+  // MBR with one FAT32 partition
+  p = disk[0] + 446;
+  p[4] = 0x0b;
+  DISK_SIM_Put32(p + 8, DISK_SIM_PARTITION);
+  DISK_SIM_Put32(p + 12, DISK_SIM_SECTORS - DISK_SIM_PARTITION);
+  DISK_SIM_Put16(disk[0] + 510, 0xaa55);
+
+  // boot sector
+  p = disk[DISK_SIM_PARTITION];
+  memcpy(p, "\xeb\x58\x90" "MSWIN4.1", 11);
+  DISK_SIM_Put16(p + 11, 512);          // bytes per sector
+  p[13] = 1;                            // sectors per cluster
+  DISK_SIM_Put16(p + 14, DISK_SIM_RESERVED);
+  p[16] = 2;                            // number of FATs
+  p[21] = 0xf8;                         // media type
+  DISK_SIM_Put32(p + 28, DISK_SIM_PARTITION);
+  DISK_SIM_Put32(p + 32, DISK_SIM_SECTORS - DISK_SIM_PARTITION);
+  DISK_SIM_Put32(p + 36, DISK_SIM_FAT_SIZE);
+  DISK_SIM_Put32(p + 44, 2);            // root cluster
+  DISK_SIM_Put16(p + 48, 1);            // FS info sector
+  DISK_SIM_Put16(p + 50, 6);            // backup boot sector
+  DISK_SIM_Put16(p + 510, 0xaa55);
+
+  DISK_SIM_SetFat(0, 0x0ffffff8);
+  DISK_SIM_SetFat(1, 0x0fffffff);
+  DISK_SIM_SetFat(2, 0x0fffffff);       // root directory
+
+  memcpy(disk[DISK_SIM_DATA], "SIMDISK    ", 11);
+  disk[DISK_SIM_DATA][11] = 0x08;       // volume label
+  rootEntries = 1;
+  nextCluster = 3;
+}
+/**
+ * @brief Adds a file to the root directory.
+ *
+ * @param name Name of file - 8 characters of name and 3 of extension, padded
+ * with spaces (as in the directory entry, e.g. "IMAGE   BMP").
+ * @param data Contents of file
+ * @param size Size of file in bytes
+ *
+ * @retval 0 File added
+ * @retval -1 Disk or root directory full
+ */
+int DISK_SIM_AddFile(const char* name, const void* data, uint32_t size) {
+
+  const uint32_t clusters = (size + 511) / 512;
+  const uint32_t first = clusters ? nextCluster : 0;
+
+  // the root directory is one cluster long
+  if (rootEntries >= 512 / 32 ||
+      DISK_SIM_DATA + nextCluster - 2 + clusters > DISK_SIM_SECTORS) {
+    return -1;
+  }
+
+  for (uint32_t i = 0; i < clusters; i++) {
+    DISK_SIM_SetFat(first + i, (i + 1 < clusters) ? first + i + 1 : 0x0fffffff);
+  }
+  memcpy(disk[DISK_SIM_DATA + first - 2], data, size);
+  nextCluster += clusters;
+
+  uint8_t* entry = disk[DISK_SIM_DATA] + 32 * rootEntries++;
+  memcpy(entry, name, 11);
+  entry[11] = 0x20;                     // archive
+  DISK_SIM_Put16(entry + 20, first >> 16);
+  DISK_SIM_Put16(entry + 26, first & 0xffff);
+  DISK_SIM_Put32(entry + 28, size);
+
+  return 0;
+}
+/**
+ * @brief Physical layer initialization - nothing to do.
+ */
+void DISK_SIM_Init(void) {
+
+}
+/**
+ * @brief Reads sectors of the disk.
+ * @param buf Destination
+ * @param sector First sector
+ * @param count Number of sectors
+ * @retval 0 Sectors read
+ * @retval 1 Sectors outside of the disk
+ */
+uint8_t DISK_SIM_Read(uint8_t* buf, uint32_t sector, uint32_t count) {
+
+  if (sector + count > DISK_SIM_SECTORS) {
+    return 1;
+  }
+
+  memcpy(buf, disk[sector], count * 512);
+  return 0;
+}
+/**
+ * @brief Writes sectors of the disk.
+ * @param buf Source
+ * @param sector First sector
+ * @param count Number of sectors
+ * @retval 0 Sectors written
+ * @retval 1 Sectors outside of the disk
+ */
+uint8_t DISK_SIM_Write(uint8_t* buf, uint32_t sector, uint32_t count) {
+
+  if (sector + count > DISK_SIM_SECTORS) {
+    return 1;
+  }
+
+  memcpy(disk[sector], buf, count * 512);
+  return 0;
+}
+/**
+ * @brief Stores a little endian 16 bit value.
+ * @param p Destination
+ * @param val Value
+ */
+static void DISK_SIM_Put16(uint8_t* p, uint16_t val) {
+
+  p[0] = val;
+  p[1] = val >> 8;
+}
+/**
+ * @brief Stores a little endian 32 bit value.
+ * @param p Destination
+ * @param val Value
+ */
+static void DISK_SIM_Put32(uint8_t* p, uint32_t val) {
+
+  DISK_SIM_Put16(p, val);
+  DISK_SIM_Put16(p + 2, val >> 16);
+}
+/**
+ * @brief Sets an entry in both FATs.
+ * @param cluster Cluster
+ * @param val Next cluster of the file
+ */
+static void DISK_SIM_SetFat(uint32_t cluster, uint32_t val) {
+
+  for (int i = 0; i < 2; i++) {
+    DISK_SIM_Put32(disk[DISK_SIM_PARTITION + DISK_SIM_RESERVED +
+        i * DISK_SIM_FAT_SIZE] + 4 * cluster, val);
+  }
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,37 @@
+/**
+ * @file    disk_sim.h
+ * @brief   Host side RAM disk with a FAT32 partition.
+ * @date    16 paź 2026
+ * @author  agent
+ *
+ * @verbatim
+ * Copyright (c) 2026 agent.
+ * All rights reserved. This program and the
+ * accompanying materials are made available
+ * under the terms of the GNU Public License
+ * v3.0 which accompanies this distribution,
+ * and is available at
+ * http://www.gnu.org/licenses/gpl.html
+ * @endverbatim
+ */
+#ifndef DISK_SIM_H_
+#define DISK_SIM_H_
+
+#include <inttypes.h>
+
+/**
+ * @addtogroup ILI9320_SIM
+ * @{
+ */
+
+void    DISK_SIM_Format   (void);
+int     DISK_SIM_AddFile  (const char* name, const void* data, uint32_t size);
+void    DISK_SIM_Init     (void);
+uint8_t DISK_SIM_Read     (uint8_t* buf, uint32_t sector, uint32_t count);
+uint8_t DISK_SIM_Write    (uint8_t* buf, uint32_t sector, uint32_t count);
+
+/**
+ * @}
+ */
+
+#endif /* DISK_SIM_H_ */
@@ -0,0 +1,585 @@
+/**
+ * @file    ili9320_hal_sim.c
+ * @brief   Host side implementation of the ILI9320 hardware abstraction layer.
+ * @date    16 paź 2026
+ * @author  agent
+ *
+ * @details Replaces hal/src/ili9320_hal.c when the graphics stack
+ * is built on a PC. The controller is modeled on the level of the
+ * bus: the index register, the control registers, the GRAM address
+ * counter (registers 0x20/0x21) with its window (registers 0x50-0x53)
+ * and entry mode (register 0x03), and the GRAM itself. Every bus
+ * cycle is counted, so drawing functions can be compared by the
+ * bus traffic they generate. The displayed image follows the base
+ * image scroll (registers 0x61 and 0x6A) and the partial images
+ * (registers 0x07 and 0x80-0x85), which are shown only with the
+ * base image turned off, as on the real controller.
+ *
+ * Time is virtual - every bus cycle takes the time set by the FSMC
+ * timing (HCLK 168 MHz) and every reading of the time SIM_POLL_NS.
+ * Writes faster than the panel accepts (SIM_PANEL_MIN_CYCLE) lose
+ * the lowest bit of every byte. The panel scans its lines at the
+ * nominal frame rate (register 0x2B) from time 0, pulses FMARK as
+ * set by register 0x0A (the interrupt is taken when the time is read)
+ * and GRAM writes to the line being scanned are counted as tearing.
+ *
+ * The GRAM address space is 256 (horizontal) by 512 (vertical)
+ * words, but only 240x320 of it is shown on the display. The
+ * horizontal address is the Y axis of the display and the vertical
+ * address is the X axis. The GRAM keeps colors as written. The
+ * controller stores them with red and blue swapped when the BGR bit
+ * (register 0x03) is set, so GRAM reads return them swapped.
+ *
+ * @verbatim
+ * Copyright (c) 2026 agent.
+ * All rights reserved. This program and the
+ * accompanying materials are made available
+ * under the terms of the GNU Public License
+ * v3.0 which accompanies this distribution,
+ * and is available at
+ * http://www.gnu.org/licenses/gpl.html
+ * @endverbatim
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <ili9320_hal.h>
+#include <ili9320_sim.h>
+
+/**
+ * @addtogroup ILI9320_SIM
+ * @{
+ */
+
+#define SIM_ID              0x9320  ///< Value read from register 0x00
+#define SIM_GRAM_H          256     ///< Size of horizontal GRAM address space
+#define SIM_GRAM_V          512     ///< Size of vertical GRAM address space
+#define SIM_VISIBLE_H       240     ///< Visible lines in horizontal direction (Y axis)
+#define SIM_VISIBLE_V       320     ///< Visible lines in vertical direction (X axis)
+
+#define SIM_REG_READ_ID     0x00
+#define SIM_REG_DISP1       0x07
+#define SIM_REG_DISP4       0x0a
+#define SIM_REG_ENTRY_MODE  0x03
+#define SIM_REG_HOR_ADDR    0x20
+#define SIM_REG_VER_ADDR    0x21
+#define SIM_REG_GRAM        0x22
+#define SIM_REG_HOR_START   0x50
+#define SIM_REG_HOR_END     0x51
+#define SIM_REG_VER_START   0x52
+#define SIM_REG_VER_END     0x53
+#define SIM_REG_BASE_IMAGE  0x61
+#define SIM_REG_FRAME_RATE  0x2b
+#define SIM_REG_SCROLL      0x6a
+#define SIM_REG_PARTIAL1    0x80    ///< Partial image 1 position, start and end
+#define SIM_REG_PARTIAL2    0x83    ///< Partial image 2 position, start and end
+
+#define SIM_ENTRY_AM        0x0008  ///< Address counter updated in vertical direction first
+#define SIM_ENTRY_ID0       0x0010  ///< Horizontal address incremented
+#define SIM_ENTRY_ID1       0x0020  ///< Vertical address incremented
+#define SIM_ENTRY_BGR       0x1000  ///< Red and blue swapped when written
+
+#define SIM_BASE_IMAGE_VLE  0x0002  ///< Vertical scroll enabled
+#define SIM_DISP1_PTDE0     0x1000  ///< Partial image 1 enabled
+#define SIM_DISP1_PTDE1     0x2000  ///< Partial image 2 enabled
+#define SIM_DISP1_BASEE     0x0100  ///< Base image enabled
+#define SIM_NON_DISPLAY     0x0000  ///< Color of lines showing no image
+#define SIM_DISP4_FMARKOE   0x0008  ///< FMARK output enabled
+#define SIM_DISP4_FMI       0x0007  ///< FMARK interval
+
+#define SIM_HCLK_MHZ        168     ///< FSMC clock
+#define SIM_PANEL_MIN_CYCLE 11      ///< Shortest write cycle accepted by panel (HCLK cycles)
+#define SIM_PANEL_MIN_DATA  3       ///< Shortest write pulse accepted by panel (HCLK cycles)
+#define SIM_POLL_NS         100     ///< Duration of reading the time
+#define SIM_BACK_PORCH      2       ///< Lines of back porch
+#define SIM_FRAME_LINES     (SIM_VISIBLE_V + 4) ///< Lines scanned in a frame
+
+static uint16_t gram[SIM_GRAM_V][SIM_GRAM_H]; ///< Simulated GRAM
+static uint16_t regs[256];        ///< Control registers
+static uint16_t indexReg;         ///< Index register
+static uint16_t acH;              ///< Horizontal part of address counter
+static uint16_t acV;              ///< Vertical part of address counter
+static uint8_t readDummy;         ///< The first GRAM read after setting the index is a dummy read
+static uint32_t writeNs;          ///< Duration of a write cycle
+static uint32_t readNs;           ///< Duration of a read cycle
+static uint8_t writeFaulty;       ///< Write timing is too fast for the panel
+static ILI9320_SIM_Stats stats;   ///< Bus cycle counters
+static uint64_t simTime;          ///< Virtual time in nanoseconds
+static uint64_t irqTime;          ///< Time of the FMARK pulse being handled (0 - none)
+static uint64_t lastPulse;        ///< Number of the last frame which pulsed FMARK
+static void (*fmarkCallback)(void); ///< FMARK interrupt handler
+
+/**
+ * @brief Nominal frame rates (Hz) selected by register 0x2B.
+ */
+static const uint8_t frameRates[16] = {
+    40, 43, 45, 48, 51, 55, 59, 64, 70, 77, 85, 96, 110, 128, 128, 128
+};
+
+static void SIM_WriteData(uint16_t data);
+static void SIM_StepCounter(void);
+static uint64_t SIM_FramePeriod(void);
+static uint16_t SIM_Read(void);
+static int SIM_ScanLine(void);
+
+/**
+ * @brief Initialize the simulated hardware.
+ */
+void ILI9320_HAL_HardInit(void) {
+
+  memset(gram, 0, sizeof(gram));
+  memset(regs, 0, sizeof(regs));
+  indexReg = 0;
+  acH = 0;
+  acV = 0;
+  readDummy = 0;
+  ILI9320_HAL_SetWriteTiming(ILI9320_HAL_ADDRESS_SETUP, ILI9320_HAL_DATA_SETUP);
+  readNs = writeNs;
+  simTime = 0;
+  irqTime = 0;
+  lastPulse = 0;
+  fmarkCallback = 0;
+  ILI9320_SIM_ResetStats();
+}
+/**
+ * @brief Writes a register.
+ * @param reg Register address.
+ * @param data Data to write.
+ */
+void ILI9320_HAL_WriteReg(uint16_t reg, uint16_t data) {
+
+  ILI9320_HAL_WriteIndex(reg);
+  ILI9320_HAL_WriteData(data);
+}
+/**
+ * @brief Selects a register.
+ * @param reg Register address.
+ */
+void ILI9320_HAL_WriteIndex(uint16_t reg) {
+
+  stats.indexCycles++;
+  simTime += writeNs;
+  indexReg = reg & 0xff;
+  readDummy = 1;
+}
+/**
+ * @brief Writes data to the selected register.
+ * @param data Data to write.
+ */
+void ILI9320_HAL_WriteData(uint16_t data) {
+
+  SIM_WriteData(data);
+}
+/**
+ * @brief Writes a buffer to the selected register.
+ * @param buf Data to write.
+ * @param len Number of words.
+ */
+void ILI9320_HAL_WriteDataBuffer(const uint16_t* buf, uint32_t len) {
+
+  while (len--) {
+    SIM_WriteData(*buf++);
+  }
+}
+/**
+ * @brief Writes the same data len times to the selected register.
+ * @param data Data to write.
+ * @param len Number of words.
+ */
+void ILI9320_HAL_FillData(uint16_t data, uint32_t len) {
+
+  while (len--) {
+    SIM_WriteData(data);
+  }
+}
+/**
+ * @brief Simulated DMA fill - done synchronously.
+ * @param data Data to write.
+ * @param len Number of words.
+ * @param cb Callback called after the transfer.
+ */
+void ILI9320_HAL_DMAFill(uint16_t data, uint32_t len, void (*cb)(void)) {
+
+  stats.dmaTransfers++;
+  ILI9320_HAL_FillData(data, len);
+  if (cb) {
+    cb();
+  }
+}
+/**
+ * @brief Simulated DMA buffer write - done synchronously.
+ * @param buf Data to write.
+ * @param len Number of words.
+ * @param cb Callback called after the transfer.
+ */
+void ILI9320_HAL_DMAWrite(const uint16_t* buf, uint32_t len, void (*cb)(void)) {
+
+  stats.dmaTransfers++;
+  ILI9320_HAL_WriteDataBuffer(buf, len);
+  if (cb) {
+    cb();
+  }
+}
+/**
+ * @brief Simulated DMA is never busy.
+ * @return 0
+ */
+uint8_t ILI9320_HAL_DMABusy(void) {
+
+  return 0;
+}
+/**
+ * @brief Reads a register.
+ * @param reg Register address.
+ * @return Contents of register.
+ */
+uint16_t ILI9320_HAL_ReadReg(uint16_t reg) {
+
+  ILI9320_HAL_WriteIndex(reg);
+  return SIM_Read();
+}
+/**
+ * @brief Reads data from the selected register.
+ * @return Data read.
+ */
+uint16_t ILI9320_HAL_ReadData(void) {
+
+  return SIM_Read();
+}
+/**
+ * @brief Reads len words from the selected register.
+ * @param buf Buffer for data.
+ * @param len Number of words.
+ */
+void ILI9320_HAL_ReadDataBuffer(uint16_t* buf, uint32_t len) {
+
+  while (len--) {
+    *buf++ = SIM_Read();
+  }
+}
+/**
+ * @brief Sets the duration of write cycles.
+ * @param addressSetup Address setup time (HCLK cycles)
+ * @param dataSetup Data setup time (HCLK cycles)
+ */
+void ILI9320_HAL_SetWriteTiming(uint8_t addressSetup, uint8_t dataSetup) {
+
+  const uint32_t cycles = addressSetup + dataSetup + 2;
+
+  writeNs = cycles * 1000 / SIM_HCLK_MHZ;
+  writeFaulty = cycles < SIM_PANEL_MIN_CYCLE || dataSetup < SIM_PANEL_MIN_DATA;
+}
+/**
+ * @brief Handles a read cycle.
+ * @return Data read from the selected register.
+ */
+static uint16_t SIM_Read(void) {
+
+  uint16_t ret;
+
+  stats.readCycles++;
+  simTime += readNs;
+
+  switch (indexReg) {
+  case SIM_REG_READ_ID:
+    return SIM_ID;
+  case SIM_REG_GRAM:
+    if (readDummy) {
+      readDummy = 0;
+      return 0;
+    }
+    ret = gram[acV][acH];
+    SIM_StepCounter();
+    // read back as stored by the controller
+    if (regs[SIM_REG_ENTRY_MODE] & SIM_ENTRY_BGR) {
+      ret = (ret << 11) | (ret & 0x07e0) | (ret >> 11);
+    }
+    return ret;
+  default:
+    return regs[indexReg];
+  }
+}
+/**
+ * @brief Reset pin - nothing to do.
+ */
+void ILI9320_HAL_ResetOn(void) {
+
+}
+/**
+ * @brief Reset pin - nothing to do.
+ */
+void ILI9320_HAL_ResetOff(void) {
+
+}
+/**
+ * @brief Sets the FMARK interrupt handler.
+ * @param cb Callback function called on every FMARK pulse.
+ */
+void ILI9320_HAL_FmarkInit(void (*cb)(void)) {
+
+  fmarkCallback = cb;
+  lastPulse = simTime / SIM_FramePeriod();
+}
+/**
+ * @brief Returns the virtual time.
+ *
+ * @details Pending FMARK interrupts are taken here - during the
+ * handler the time of the pulse is returned.
+ *
+ * @return Time in nanoseconds.
+ */
+uint32_t ILI9320_HAL_GetTicks(void) {
+
+  static const uint8_t intervals[8] = {1, 2, 2, 4, 4, 6, 6, 6};
+  const uint64_t period = SIM_FramePeriod();
+  uint64_t frame;
+
+  if (irqTime) {
+    return irqTime;
+  }
+
+  simTime += SIM_POLL_NS;
+
+  if (fmarkCallback && (regs[SIM_REG_DISP4] & SIM_DISP4_FMARKOE)) {
+    const uint8_t interval = intervals[regs[SIM_REG_DISP4] & SIM_DISP4_FMI];
+    for (frame = lastPulse + 1; frame * period <= simTime; frame++) {
+      if (frame % interval == 0) {
+        irqTime = frame * period;
+        fmarkCallback();
+        irqTime = 0;
+      }
+    }
+    lastPulse = frame - 1;
+  }
+
+  return simTime;
+}
+/**
+ * @brief Returns the frequency of ILI9320_HAL_GetTicks().
+ * @return Ticks per second.
+ */
+uint32_t ILI9320_HAL_TickFreq(void) {
+
+  return 1000000000;
+}
+/**
+ * @brief Handles a data cycle.
+ * @param data Data written on the bus.
+ */
+static void SIM_WriteData(uint16_t data) {
+
+  if (writeFaulty) {
+    data &= 0xfefe;
+  }
+
+  if (indexReg != SIM_REG_GRAM) {
+    stats.regCycles++;
+    simTime += writeNs;
+    regs[indexReg] = data;
+
+    if (indexReg == SIM_REG_HOR_ADDR) {
+      acH = data & (SIM_GRAM_H - 1);
+    } else if (indexReg == SIM_REG_VER_ADDR) {
+      acV = data & (SIM_GRAM_V - 1);
+    }
+    return;
+  }
+
+  stats.gramCycles++;
+  simTime += writeNs;
+
+  if (acV < SIM_VISIBLE_V) {
+    int line = acV;
+    if (regs[SIM_REG_BASE_IMAGE] & SIM_BASE_IMAGE_VLE) {
+      line = (acV + SIM_VISIBLE_V - regs[SIM_REG_SCROLL] % SIM_VISIBLE_V)
+          % SIM_VISIBLE_V;
+    }
+    if (line == SIM_ScanLine()) {
+      stats.scanWrites++;
+    }
+  }
+
+  if (acH >= SIM_VISIBLE_H || acV >= SIM_VISIBLE_V) {
+    stats.offscreenWrites++;
+  }
+  gram[acV][acH] = data;
+
+  SIM_StepCounter();
+}
+/**
+ * @brief Updates the address counter after a GRAM access.
+ *
+ * @details The counter moves in the direction set by the AM bit
+ * and wraps around inside the window set by registers 0x50-0x53.
+ */
+static void SIM_StepCounter(void) {
+
+  const uint16_t entry = regs[SIM_REG_ENTRY_MODE];
+  const int hStep = (entry & SIM_ENTRY_ID0) ? 1 : -1;
+  const int vStep = (entry & SIM_ENTRY_ID1) ? 1 : -1;
+  const uint16_t hStart = regs[SIM_REG_HOR_START];
+  const uint16_t hEnd = regs[SIM_REG_HOR_END];
+  const uint16_t vStart = regs[SIM_REG_VER_START];
+  const uint16_t vEnd = regs[SIM_REG_VER_END];
+
+  int h = acH;
+  int v = acV;
+
+  if (entry & SIM_ENTRY_AM) {
+    v += vStep;
+    if (v > vEnd || v < vStart) {
+      v = vStep > 0 ? vStart : vEnd;
+      h += hStep;
+      if (h > hEnd || h < hStart) {
+        h = hStep > 0 ? hStart : hEnd;
+      }
+    }
+  } else {
+    h += hStep;
+    if (h > hEnd || h < hStart) {
+      h = hStep > 0 ? hStart : hEnd;
+      v += vStep;
+      if (v > vEnd || v < vStart) {
+        v = vStep > 0 ? vStart : vEnd;
+      }
+    }
+  }
+
+  acH = h & (SIM_GRAM_H - 1);
+  acV = v & (SIM_GRAM_V - 1);
+}
+/**
+ * @brief Returns the nominal frame period.
+ * @return Frame period in nanoseconds.
+ */
+static uint64_t SIM_FramePeriod(void) {
+
+  return 1000000000ULL / frameRates[regs[SIM_REG_FRAME_RATE] & 0x0f];
+}
+/**
+ * @brief Returns the line being scanned.
+ * @return Line of the display, -1 in porches.
+ */
+static int SIM_ScanLine(void) {
+
+  const uint64_t period = SIM_FramePeriod();
+  const int line = (simTime % period) * SIM_FRAME_LINES / period;
+
+  return (line >= SIM_BACK_PORCH && line < SIM_BACK_PORCH + SIM_VISIBLE_V) ?
+      line - SIM_BACK_PORCH : -1;
+}
+/**
+ * @brief Returns the virtual time.
+ * @return Time in microseconds.
+ */
+uint32_t ILI9320_SIM_GetTimeUS(void) {
+
+  return simTime / 1000;
+}
+/**
+ * @brief Clears the bus cycle counters.
+ */
+void ILI9320_SIM_ResetStats(void) {
+
+  memset(&stats, 0, sizeof(stats));
+}
+/**
+ * @brief Reads the bus cycle counters.
+ * @param s Structure to fill.
+ */
+void ILI9320_SIM_GetStats(ILI9320_SIM_Stats* s) {
+
+  *s = stats;
+}
+/**
+ * @brief Returns the total number of bus cycles since the last reset.
+ * @return Number of bus cycles.
+ */
+uint32_t ILI9320_SIM_BusCycles(void) {
+
+  return stats.indexCycles + stats.regCycles +
+      stats.gramCycles + stats.readCycles;
+}
+/**
+ * @brief Returns a pixel as seen on the display.
+ *
+ * @details With scrolling enabled the display line x shows
+ * the GRAM line x + VL (wrapped around the visible lines).
+ * The base image is shown only when BASEE is set. Otherwise the
+ * enabled partial images (not scrolled) are shown on their lines
+ * and the other lines show the non-display level (black here).
+ * Partial images are ignored while the base image is on.
+ *
+ * @param x X coordinate (line of the display).
+ * @param y Y coordinate (horizontal GRAM address).
+ * @return Pixel color (RGB565).
+ */
+uint16_t ILI9320_SIM_GetPixel(uint16_t x, uint16_t y) {
+
+  static const uint16_t partial[2][2] = {
+      {SIM_DISP1_PTDE0, SIM_REG_PARTIAL1},
+      {SIM_DISP1_PTDE1, SIM_REG_PARTIAL2},
+  };
+
+  if (!(regs[SIM_REG_DISP1] & SIM_DISP1_BASEE)) {
+    for (int i = 0; i < 2; i++) {
+      const uint16_t* p = &regs[partial[i][1]];
+      if ((regs[SIM_REG_DISP1] & partial[i][0]) &&
+          x >= p[0] && x <= p[0] + p[2] - p[1]) {
+        return gram[(x - p[0] + p[1]) & (SIM_GRAM_V - 1)][y & (SIM_GRAM_H - 1)];
+      }
+    }
+    return SIM_NON_DISPLAY;
+  }
+
+  if ((regs[SIM_REG_BASE_IMAGE] & SIM_BASE_IMAGE_VLE) && x < SIM_VISIBLE_V) {
+    x = (x + regs[SIM_REG_SCROLL]) % SIM_VISIBLE_V;
+  }
+
+  return gram[x & (SIM_GRAM_V - 1)][y & (SIM_GRAM_H - 1)];
+}
+/**
+ * @brief Returns the last value written to a control register.
+ * @param reg Register address.
+ * @return Register value.
+ */
+uint16_t ILI9320_SIM_GetReg(uint16_t reg) {
+
+  return regs[reg & 0xff];
+}
+/**
+ * @brief Writes the visible part of the GRAM to a binary PPM file.
+ * @param filename Name of file.
+ * @retval 0 File written
+ * @retval -1 Error
+ */
+int ILI9320_SIM_DumpPPM(const char* filename) {
+
+  FILE* f = fopen(filename, "wb");
+
+  if (f == NULL) {
+    return -1;
+  }
+
+  fprintf(f, "P6\n%d %d\n255\n", SIM_VISIBLE_V, SIM_VISIBLE_H);
+
+  for (int y = 0; y < SIM_VISIBLE_H; y++) {
+    for (int x = 0; x < SIM_VISIBLE_V; x++) {
+      uint16_t c = ILI9320_SIM_GetPixel(x, y);
+      uint8_t rgb[3];
+      // expand 5/6/5 bits to 8 bits
+      rgb[0] = ((c >> 11) & 0x1f) * 255 / 31;
+      rgb[1] = ((c >> 5) & 0x3f) * 255 / 63;
+      rgb[2] = (c & 0x1f) * 255 / 31;
+      fwrite(rgb, 1, sizeof(rgb), f);
+    }
+  }
+
+  fclose(f);
+  return 0;
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,57 @@
+/**
+ * @file    ili9320_sim.h
+ * @brief   Host side simulator of the ILI9320 bus.
+ * @date    16 paź 2026
+ * @author  agent
+ *
+ * @verbatim
+ * Copyright (c) 2026 agent.
+ * All rights reserved. This program and the
+ * accompanying materials are made available
+ * under the terms of the GNU Public License
+ * v3.0 which accompanies this distribution,
+ * and is available at
+ * http://www.gnu.org/licenses/gpl.html
+ * @endverbatim
+ */
+#ifndef ILI9320_SIM_H_
+#define ILI9320_SIM_H_
+
+#include <inttypes.h>
+
+/**
+ * @defgroup  ILI9320_SIM ILI9320_SIM
+ * @brief     Host side simulator of the ILI9320 bus
+ */
+
+/**
+ * @addtogroup ILI9320_SIM
+ * @{
+ */
+
+/**
+ * @brief Bus cycle counters of the simulated LCD.
+ */
+typedef struct {
+  uint32_t indexCycles;     ///< Writes to the index register (RS low)
+  uint32_t regCycles;       ///< Data writes to control registers
+  uint32_t gramCycles;      ///< Data writes to the GRAM
+  uint32_t readCycles;      ///< Data reads (registers and GRAM)
+  uint32_t offscreenWrites; ///< GRAM writes outside the visible 320x240 area
+  uint32_t dmaTransfers;    ///< Number of DMA transfers started
+  uint32_t scanWrites;      ///< GRAM writes to the line being scanned (tearing)
+} ILI9320_SIM_Stats;
+
+void      ILI9320_SIM_ResetStats  (void);
+void      ILI9320_SIM_GetStats    (ILI9320_SIM_Stats* stats);
+uint32_t  ILI9320_SIM_BusCycles   (void);
+uint16_t  ILI9320_SIM_GetPixel    (uint16_t x, uint16_t y);
+uint16_t  ILI9320_SIM_GetReg      (uint16_t reg);
+uint32_t  ILI9320_SIM_GetTimeUS   (void);
+int       ILI9320_SIM_DumpPPM     (const char* filename);
+
+/**
+ * @}
+ */
+
+#endif /* ILI9320_SIM_H_ */
@@ -0,0 +1,67 @@
+/**
+ * @file    systick_sim.c
+ * @brief   Host side implementation of the system time sources.
+ * @date    16 paź 2026
+ * @author  agent
+ *
+ * @details Time is virtual - it advances every time it is read,
+ * so delays in the drivers (LCD reset, power up) end immediately
+ * and do not slow down the simulation.
+ *
+ * @verbatim
+ * Copyright (c) 2026 agent.
+ * All rights reserved. This program and the
+ * accompanying materials are made available
+ * under the terms of the GNU Public License
+ * v3.0 which accompanies this distribution,
+ * and is available at
+ * http://www.gnu.org/licenses/gpl.html
+ * @endverbatim
+ */
+
+#include <inttypes.h>
+#include <systick.h>
+#include <timer14.h>
+
+/**
+ * @addtogroup ILI9320_SIM
+ * @{
+ */
+
+static uint32_t msCount; ///< Virtual millisecond counter
+static uint32_t usCount; ///< Virtual microsecond counter
+
+/**
+ * @brief Nothing to initialize.
+ * @param freq Ignored.
+ */
+void SYSTICK_Init(uint32_t freq) {
+
+  (void)freq;
+}
+/**
+ * @brief Get virtual time.
+ * @return Time in milliseconds
+ */
+uint32_t SYSTICK_GetTime(void) {
+
+  return msCount++;
+}
+/**
+ * @brief Nothing to initialize.
+ */
+void TIMER14_Init(void) {
+
+}
+/**
+ * @brief Get virtual time.
+ * @return Time in microseconds
+ */
+uint32_t TIMER14_GetTime(void) {
+
+  return usCount++;
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,686 @@
+/**
+ * @file    imgconv.c
+ * @brief   Host side converter of BMP files to image headers.
+ * @date    16 paź 2026
+ * @author  agent
+ *
+ * @details Reads an uncompressed 24 or 32 bit BMP file and writes
+ * a C header with the pixels converted to RGB565 (the format of the
+ * LCD) and a GRAPH_ImageStruct describing them, so GRAPH_DrawImage()
+ * sends the image from flash in a single burst, without converting
+ * it. An RGB565 image also takes a third less flash than RGB888.
+ *
+ * Flat art (icons, buttons, backgrounds) is better compressed with
+ * runs (see GRAPH_ImageStruct). Images with up to 256 colors are
+ * written as RLE8 with a palette, others as RLE565. The compression
+ * ratio is printed on stderr.
+ *
+ * Icons with few colors are written as indexed images - packed
+ * indices of the smallest size (1, 2, 4 or 8 bits) holding all
+ * colors, with a palette. Pixels of the transparent color get
+ * index 0 and are not drawn over the background.
+ *
+ * Usage: imgconv [-d] [-f format] [-t rrggbb] [-n name] input.bmp > name.h
+ *
+ *   -d         dither to RGB565 (the 4x4 Bayer pattern of GRAPH_SetDither(),
+ *              fixed to the top left corner of the image)
+ *   -f format  rgb565 (default), rle or index
+ *   -t rrggbb  transparent color of an indexed image (hexadecimal RGB)
+ *   -n name    name of the data array, the image structure is called
+ *              nameImage (default: name of input file, without extension)
+ *
+ * @verbatim
+ * Copyright (c) 2026 agent.
+ * All rights reserved. This program and the
+ * accompanying materials are made available
+ * under the terms of the GNU Public License
+ * v3.0 which accompanies this distribution,
+ * and is available at
+ * http://www.gnu.org/licenses/gpl.html
+ * @endverbatim
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <ctype.h>
+
+#define CONV_VALUES_PER_LINE 12 ///< Array values written in one line
+#define CONV_MIN_RUN         3  ///< Shortest run, which breaks a literal
+#define CONV_MAX_RLE565      0x8000 ///< Longest packet of RLE565 image
+#define CONV_MAX_RLE8        0x4000 ///< Longest packet of RLE8 image
+
+/**
+ * @brief Image loaded from a file.
+ */
+typedef struct {
+  int width;      ///< Number of pixel columns
+  int height;     ///< Number of pixel rows
+  uint8_t* rgb;   ///< Pixels, 3 bytes (R, G, B) each, top row first
+} CONV_Image;
+
+/**
+ * @brief Encoded packets of an RLE image.
+ */
+typedef struct {
+  uint16_t* data; ///< Words (RLE565) or bytes (RLE8) of packets
+  long len;       ///< Number of words or bytes
+  int rle8;       ///< 1 - RLE8, 0 - RLE565
+} CONV_Rle;
+
+static int CONV_LoadBmp(const char* path, CONV_Image* img);
+static uint16_t CONV_ToRGB565(const uint8_t* p, int x, int y, int dither);
+static uint16_t* CONV_Convert(const CONV_Image* img, int dither);
+static void CONV_WriteRGB565(FILE* out, const CONV_Image* img,
+    const uint16_t* pixels, const char* name, const char* source,
+    int dither);
+static void CONV_WriteRle(FILE* out, const CONV_Image* img,
+    const uint16_t* pixels, const char* name, const char* source,
+    int dither);
+static int CONV_WriteIndexed(FILE* out, const CONV_Image* img,
+    const uint16_t* pixels, const char* name, const char* source,
+    int dither, long key);
+static int CONV_Palette(const uint16_t* pixels, long n, uint16_t* palette,
+    uint16_t* indices, int first, int colors);
+static void CONV_Encode(CONV_Rle* rle, const uint16_t* symbols, long n);
+static void CONV_Put(CONV_Rle* rle, uint16_t value);
+static void CONV_PutHeader(CONV_Rle* rle, int isRun, long n);
+static void CONV_WritePrologue(FILE* out, const CONV_Image* img,
+    const char* name, const char* source, const char* format);
+static void CONV_WriteArray(FILE* out, const char* type, const char* name,
+    const uint16_t* values, long n, int digits);
+static void CONV_WriteEpilogue(FILE* out, const CONV_Image* img,
+    const char* name, const char* format, const char* palette, int key);
+static uint32_t CONV_Get32(const uint8_t* p);
+static uint16_t CONV_Get16(const uint8_t* p);
+
+int main(int argc, char** argv) {
+
+  CONV_Image img;
+  const char* input = 0;
+  char name[64] = "";
+  int dither = 0;
+  int rle = 0;
+  int indexed = 0;
+  long key = -1;
+  int ret = 0;
+  int i;
+
+  for (i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-d")) {
+      dither = 1;
+    } else if (!strcmp(argv[i], "-f") && i + 1 < argc &&
+        (!strcmp(argv[i + 1], "rgb565") || !strcmp(argv[i + 1], "rle") ||
+        !strcmp(argv[i + 1], "index"))) {
+      rle = !strcmp(argv[++i], "rle");
+      indexed = !strcmp(argv[i], "index");
+    } else if (!strcmp(argv[i], "-t") && i + 1 < argc &&
+        strlen(argv[i + 1]) == 6 &&
+        strspn(argv[i + 1], "0123456789abcdefABCDEF") == 6) {
+      key = strtol(argv[++i], 0, 16);
+    } else if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+      snprintf(name, sizeof(name), "%s", argv[++i]);
+    } else if (argv[i][0] != '-' && !input) {
+      input = argv[i];
+    } else {
+      input = 0;
+      break;
+    }
+  }
+
+  if (!input) {
+    fprintf(stderr, "usage: %s [-d] [-f rgb565|rle|index] [-t rrggbb] "
+        "[-n name] input.bmp > name.h\n", argv[0]);
+    return 1;
+  }
+
+  const char* base = strrchr(input, '/');
+  base = base ? base + 1 : input;
+
+  // default name - file name without directory and extension
+  if (!name[0]) {
+    snprintf(name, sizeof(name), "%s", base);
+    char* dot = strrchr(name, '.');
+    if (dot) {
+      *dot = 0;
+    }
+  }
+  for (i = 0; name[i]; i++) {
+    if (!isalnum((unsigned char)name[i])) {
+      name[i] = '_';
+    }
+  }
+
+  if (CONV_LoadBmp(input, &img)) {
+    return 1;
+  }
+
+  uint16_t* pixels = CONV_Convert(&img, dither);
+  if (indexed) {
+    ret = CONV_WriteIndexed(stdout, &img, pixels, name, base, dither, key);
+  } else if (rle) {
+    CONV_WriteRle(stdout, &img, pixels, name, base, dither);
+  } else {
+    CONV_WriteRGB565(stdout, &img, pixels, name, base, dither);
+  }
+  free(pixels);
+  free(img.rgb);
+
+  return ret ? 1 : 0;
+}
+/**
+ * @brief Loads an uncompressed 24 or 32 bit BMP file.
+ * @param path Path of file
+ * @param img Loaded image (pixels have to be freed by the caller)
+ * @retval 0 Image loaded
+ * @retval -1 Error (reported on stderr)
+ */
+static int CONV_LoadBmp(const char* path, CONV_Image* img) {
+
+  uint8_t header[54];
+  FILE* f = fopen(path, "rb");
+
+  if (!f) {
+    perror(path);
+    return -1;
+  }
+
+  if (fread(header, 1, sizeof(header), f) != sizeof(header) ||
+      CONV_Get16(header) != 0x4d42) { // "BM"
+    fprintf(stderr, "%s: not a BMP file\n", path);
+    fclose(f);
+    return -1;
+  }
+
+  const uint32_t offset = CONV_Get32(header + 10);
+  const int32_t height = (int32_t)CONV_Get32(header + 22);
+  const int bpp = CONV_Get16(header + 28);
+  const uint32_t compression = CONV_Get32(header + 30);
+
+  img->width = (int32_t)CONV_Get32(header + 18);
+  img->height = (height < 0) ? -height : height;
+
+  if ((bpp != 24 && bpp != 32) || compression != 0 ||
+      img->width <= 0 || img->width > 0xffff || img->height > 0xffff) {
+    fprintf(stderr, "%s: only uncompressed 24 and 32 bit images "
+        "are supported\n", path);
+    fclose(f);
+    return -1;
+  }
+
+  // rows are padded to 4 bytes and stored bottom-up,
+  // unless the height is negative
+  const int stride = (img->width * bpp / 8 + 3) & ~3;
+  uint8_t* row = malloc(stride);
+  img->rgb = malloc((size_t)img->width * img->height * 3);
+
+  fseek(f, offset, SEEK_SET);
+  for (int y = 0; y < img->height; y++) {
+    if (fread(row, 1, stride, f) != (size_t)stride) {
+      fprintf(stderr, "%s: file truncated\n", path);
+      free(row);
+      free(img->rgb);
+      fclose(f);
+      return -1;
+    }
+    uint8_t* dst = img->rgb + (size_t)3 * img->width *
+        (height < 0 ? y : img->height - 1 - y);
+    for (int x = 0; x < img->width; x++) { // BGR(A)
+      dst[3 * x + 0] = row[x * bpp / 8 + 2];
+      dst[3 * x + 1] = row[x * bpp / 8 + 1];
+      dst[3 * x + 2] = row[x * bpp / 8 + 0];
+    }
+  }
+
+  free(row);
+  fclose(f);
+  return 0;
+}
+/**
+ * @brief Converts a pixel to RGB565.
+ *
+ * @details Dithering adds the same thresholds as GRAPH_Dither()
+ * in the graphics library.
+ *
+ * @param p Pixel (R, G, B)
+ * @param x X coordinate of pixel
+ * @param y Y coordinate of pixel
+ * @param dither 1 - ordered dithering, 0 - truncate the components
+ * @return Color (RGB565)
+ */
+static uint16_t CONV_ToRGB565(const uint8_t* p, int x, int y, int dither) {
+
+  static const uint8_t bayer[4][4] = {
+      { 0,  8,  2, 10},
+      {12,  4, 14,  6},
+      { 3, 11,  1,  9},
+      {15,  7, 13,  5},
+  };
+  const uint8_t t = dither ? bayer[y & 3][x & 3] : 0;
+  int r = p[0] + (t >> 1);
+  int g = p[1] + (t >> 2);
+  int b = p[2] + (t >> 1);
+
+  r = (r > 255) ? 255 : r;
+  g = (g > 255) ? 255 : g;
+  b = (b > 255) ? 255 : b;
+
+  return (uint16_t)(((r & 0xf8) << 8) | ((g & 0xfc) << 3) | (b >> 3));
+}
+/**
+ * @brief Converts all pixels of an image to RGB565.
+ * @param img Image
+ * @param dither 1 - ordered dithering, 0 - truncate the components
+ * @return Pixels (have to be freed by the caller)
+ */
+static uint16_t* CONV_Convert(const CONV_Image* img, int dither) {
+
+  const long n = (long)img->width * img->height;
+  uint16_t* pixels = malloc(n * sizeof(uint16_t));
+
+  for (long k = 0; k < n; k++) {
+    pixels[k] = CONV_ToRGB565(img->rgb + 3 * k, k % img->width,
+        k / img->width, dither);
+  }
+
+  return pixels;
+}
+/**
+ * @brief Writes the header with an RGB565 image.
+ * @param out Output file
+ * @param img Image
+ * @param pixels Pixels of image (RGB565)
+ * @param name Name of data array
+ * @param source Name of input file (for the comment)
+ * @param dither 1 - image was dithered (for the comment)
+ */
+static void CONV_WriteRGB565(FILE* out, const CONV_Image* img,
+    const uint16_t* pixels, const char* name, const char* source,
+    int dither) {
+
+  CONV_WritePrologue(out, img, name, source,
+      dither ? "RGB565, dithered" : "RGB565");
+  CONV_WriteArray(out, "uint16_t", name, pixels,
+      (long)img->width * img->height, 4);
+  CONV_WriteEpilogue(out, img, name, "GRAPH_IMAGE_RGB565", 0, -1);
+}
+/**
+ * @brief Writes the header with an RLE image.
+ *
+ * @details Images with up to 256 colors are encoded as RLE8, with
+ * a palette array called name_palette, other ones as RLE565.
+ * The sizes of image are reported on stderr.
+ *
+ * @param out Output file
+ * @param img Image
+ * @param pixels Pixels of image (RGB565)
+ * @param name Name of data array
+ * @param source Name of input file (for the comment)
+ * @param dither 1 - image was dithered (for the comment)
+ */
+static void CONV_WriteRle(FILE* out, const CONV_Image* img,
+    const uint16_t* pixels, const char* name, const char* source,
+    int dither) {
+
+  const long n = (long)img->width * img->height;
+  uint16_t palette[256];
+  char paletteName[80];
+  char format[40];
+  CONV_Rle rle = {0, 0, 0};
+  uint16_t* indices = malloc(n * sizeof(uint16_t));
+  const int colors = CONV_Palette(pixels, n, palette, indices, 0, 0);
+
+  if (colors <= 256) {
+    rle.rle8 = 1;
+    CONV_Encode(&rle, indices, n);
+  } else {
+    CONV_Encode(&rle, pixels, n);
+  }
+
+  const long size = rle.rle8 ? rle.len + 2 * colors : 2 * rle.len;
+  snprintf(format, sizeof(format), "%s%s", rle.rle8 ? "RLE8" : "RLE565",
+      dither ? ", dithered" : "");
+  snprintf(paletteName, sizeof(paletteName), "%s_palette", name);
+
+  fprintf(stderr, "%s: %dx%d, %s, %ld bytes (RGB565: %ld bytes), "
+      "ratio %.2f\n", name, img->width, img->height, format, size, 2 * n,
+      (double)(2 * n) / size);
+
+  CONV_WritePrologue(out, img, name, source, format);
+  if (rle.rle8) {
+    CONV_WriteArray(out, "GRAPH_Color", paletteName, palette, colors, 4);
+    fprintf(out, "\n");
+    CONV_WriteArray(out, "uint8_t", name, rle.data, rle.len, 2);
+    CONV_WriteEpilogue(out, img, name, "GRAPH_IMAGE_RLE8", paletteName, -1);
+  } else {
+    CONV_WriteArray(out, "uint16_t", name, rle.data, rle.len, 4);
+    CONV_WriteEpilogue(out, img, name, "GRAPH_IMAGE_RLE565", 0, -1);
+  }
+
+  free(rle.data);
+  free(indices);
+}
+/**
+ * @brief Writes the header with an indexed image.
+ *
+ * @details Indices take the smallest number of bits holding all colors,
+ * packed from the most significant bits, every row starting with a new
+ * byte. The palette is written as an array called name_palette,
+ * padded with black to 2^bits entries. Pixels of the transparent color (compared before conversion to
+ * RGB565) get index 0, which is the transparent index of the image.
+ *
+ * @param out Output file
+ * @param img Image
+ * @param pixels Pixels of image (RGB565)
+ * @param name Name of data array
+ * @param source Name of input file (for the comment)
+ * @param dither 1 - image was dithered (for the comment)
+ * @param key Transparent color (0xrrggbb) or -1
+ * @retval 0 Header written
+ * @retval -1 Too many colors (reported on stderr)
+ */
+static int CONV_WriteIndexed(FILE* out, const CONV_Image* img,
+    const uint16_t* pixels, const char* name, const char* source,
+    int dither, long key) {
+
+  const long n = (long)img->width * img->height;
+  const uint8_t rgb[3] = {key >> 16, key >> 8, key};
+  uint16_t palette[256];
+  char paletteName[80];
+  char format[40];
+  char type[40];
+  int transparent = 0;
+  uint16_t* indices = malloc(n * sizeof(uint16_t));
+
+  for (long k = 0; key >= 0 && k < n && !transparent; k++) {
+    transparent = !memcmp(img->rgb + 3 * k, rgb, 3);
+  }
+  if (transparent) {
+    palette[0] = CONV_ToRGB565(rgb, 0, 0, 0);
+  } else if (key >= 0) {
+    fprintf(stderr, "%s: no pixels of transparent color %06lx\n", name, key);
+  }
+
+  // index 0 is kept for transparent pixels only
+  int colors = transparent;
+  for (long k = 0; k < n && colors <= 256; k++) {
+    if (transparent && !memcmp(img->rgb + 3 * k, rgb, 3)) {
+      indices[k] = 0;
+    } else {
+      colors = CONV_Palette(pixels + k, 1, palette, indices + k,
+          transparent, colors);
+    }
+  }
+
+  if (colors > 256) {
+    fprintf(stderr, "%s: more than 256 colors, use -f rle\n", name);
+    free(indices);
+    return -1;
+  }
+
+  const int bits = (colors <= 2) ? 1 : ((colors <= 4) ? 2 :
+      ((colors <= 16) ? 4 : 8));
+  const int entries = 1 << bits;
+  const long stride = (img->width * bits + 7) / 8;
+  uint16_t* bytes = calloc(stride * img->height, sizeof(uint16_t));
+
+  for (int y = 0; y < img->height; y++) {
+    for (int x = 0; x < img->width; x++) {
+      const int bit = x * bits;
+      bytes[y * stride + bit / 8] |=
+          indices[(long)y * img->width + x] << (8 - bits - bit % 8);
+    }
+  }
+
+  // GRAPH_DrawImage() expands all 2^bits indices, so the palette is padded
+  for (int c = colors; c < entries; c++) {
+    palette[c] = 0;
+  }
+
+  const long size = stride * img->height + 2 * entries;
+  snprintf(format, sizeof(format), "%d bit indexed%s%s", bits,
+      transparent ? ", transparent" : "", dither ? ", dithered" : "");
+  snprintf(type, sizeof(type), "GRAPH_IMAGE_INDEX%d", bits);
+  snprintf(paletteName, sizeof(paletteName), "%s_palette", name);
+
+  fprintf(stderr, "%s: %dx%d, %s, %d colors, %ld bytes (RGB565: %ld bytes), "
+      "ratio %.2f\n", name, img->width, img->height, format, colors, size,
+      2 * n, (double)(2 * n) / size);
+
+  CONV_WritePrologue(out, img, name, source, format);
+  CONV_WriteArray(out, "GRAPH_Color", paletteName, palette, entries, 4);
+  fprintf(out, "\n");
+  CONV_WriteArray(out, "uint8_t", name, bytes, stride * img->height, 2);
+  CONV_WriteEpilogue(out, img, name, type, paletteName, transparent ? 0 : -1);
+
+  free(bytes);
+  free(indices);
+  return 0;
+}
+/**
+ * @brief Adds colors of pixels to a palette.
+ *
+ * @details Colors are added in the order of first use. When the
+ * palette is full, the count goes over 256 and indices are not valid.
+ *
+ * @param pixels Pixels (RGB565)
+ * @param n Number of pixels
+ * @param palette Palette (256 colors)
+ * @param indices Palette indices of pixels
+ * @param first First index searched (the ones before it are reserved)
+ * @param colors Number of colors already in palette
+ * @return Number of colors in palette (257 - too many)
+ */
+static int CONV_Palette(const uint16_t* pixels, long n, uint16_t* palette,
+    uint16_t* indices, int first, int colors) {
+
+  int c;
+
+  for (long k = 0; k < n && colors <= 256; k++) {
+    for (c = first; c < colors && palette[c] != pixels[k]; c++);
+    if (c == colors && colors++ < 256) {
+      palette[c] = pixels[k];
+    }
+    indices[k] = c;
+  }
+
+  return colors;
+}
+/**
+ * @brief Encodes pixels as runs and literals.
+ *
+ * @details Runs of at least CONV_MIN_RUN equal values are written as
+ * run packets, other values are collected in literal packets.
+ * Packets continue over the ends of rows.
+ *
+ * @param rle Encoded image (rle8 selects the format)
+ * @param symbols Colors (RLE565) or palette indices (RLE8)
+ * @param n Number of pixels
+ */
+static void CONV_Encode(CONV_Rle* rle, const uint16_t* symbols, long n) {
+
+  const long max = rle->rle8 ? CONV_MAX_RLE8 : CONV_MAX_RLE565;
+  long literal = 0; // start of the pending literal
+  long i = 0;
+
+  while (i < n) {
+    long run = 1;
+    while (i + run < n && run < max && symbols[i + run] == symbols[i]) {
+      run++;
+    }
+    // a run of two is cheaper than a new literal only at its start
+    if (run >= CONV_MIN_RUN || (run == 2 && literal == i)) {
+      if (literal < i) {
+        CONV_PutHeader(rle, 0, i - literal);
+        for (long k = literal; k < i; k++) {
+          CONV_Put(rle, symbols[k]);
+        }
+      }
+      CONV_PutHeader(rle, 1, run);
+      CONV_Put(rle, symbols[i]);
+      i += run;
+      literal = i;
+    } else {
+      i++;
+      if (i - literal == max) {
+        CONV_PutHeader(rle, 0, max);
+        for (long k = literal; k < i; k++) {
+          CONV_Put(rle, symbols[k]);
+        }
+        literal = i;
+      }
+    }
+  }
+
+  if (literal < n) {
+    CONV_PutHeader(rle, 0, n - literal);
+    for (long k = literal; k < n; k++) {
+      CONV_Put(rle, symbols[k]);
+    }
+  }
+}
+/**
+ * @brief Appends a word (RLE565) or byte (RLE8) to encoded image.
+ * @param rle Encoded image
+ * @param value Value
+ */
+static void CONV_Put(CONV_Rle* rle, uint16_t value) {
+
+  // grows by doubling
+  if ((rle->len & (rle->len - 1)) == 0) {
+    rle->data = realloc(rle->data, 2 * (rle->len + 1) * sizeof(uint16_t));
+  }
+  rle->data[rle->len++] = value;
+}
+/**
+ * @brief Appends the header of a packet to encoded image.
+ * @param rle Encoded image
+ * @param isRun 1 - run packet, 0 - literal packet
+ * @param n Number of pixels in packet
+ */
+static void CONV_PutHeader(CONV_Rle* rle, int isRun, long n) {
+
+  n--;
+  if (!rle->rle8) {
+    CONV_Put(rle, (isRun ? 0x8000 : 0) | n);
+  } else if (n < 0x40) {
+    CONV_Put(rle, (isRun ? 0x80 : 0) | n);
+  } else {
+    CONV_Put(rle, (isRun ? 0x80 : 0) | 0x40 | (n >> 8));
+    CONV_Put(rle, n & 0xff);
+  }
+}
+/**
+ * @brief Writes the beginning of the header (comment and includes).
+ * @param out Output file
+ * @param img Image
+ * @param name Name of data array
+ * @param source Name of input file (for the comment)
+ * @param format Format of image (for the comment)
+ */
+static void CONV_WritePrologue(FILE* out, const CONV_Image* img,
+    const char* name, const char* source, const char* format) {
+
+  char guard[80];
+
+  snprintf(guard, sizeof(guard), "INC_%s_H_", name);
+  for (int i = 0; guard[i]; i++) {
+    guard[i] = toupper((unsigned char)guard[i]);
+  }
+
+  fprintf(out,
+      "/**\n"
+      " * @file    %s.h\n"
+      " * @brief   Image %dx%d, %s.\n"
+      " *\n"
+      " * @details Generated by tools/imgconv from %s - do not edit.\n"
+      " */\n"
+      "#ifndef %s\n"
+      "#define %s\n"
+      "\n"
+      "#include <inttypes.h>\n"
+      "#include <graphics.h>\n"
+      "\n",
+      name, img->width, img->height, format, source, guard, guard);
+}
+/**
+ * @brief Writes a constant array.
+ * @param out Output file
+ * @param type Type of values
+ * @param name Name of array
+ * @param values Values
+ * @param n Number of values
+ * @param digits Number of hexadecimal digits of a value
+ */
+static void CONV_WriteArray(FILE* out, const char* type, const char* name,
+    const uint16_t* values, long n, int digits) {
+
+  fprintf(out, "static const %s %s[%ld] = {\n", type, name, n);
+
+  for (long k = 0; k < n; k++) {
+    fprintf(out, "%s0x%0*x,%s",
+        (k % CONV_VALUES_PER_LINE) ? " " : "    ", digits, values[k],
+        (k % CONV_VALUES_PER_LINE == CONV_VALUES_PER_LINE - 1 || k == n - 1) ?
+            "\n" : "");
+  }
+
+  fprintf(out, "};\n");
+}
+/**
+ * @brief Writes the image structure and the end of the header.
+ *
+ * @details Every field of the structure is initialized, so the
+ * header compiles cleanly with -Wextra.
+ *
+ * @param out Output file
+ * @param img Image
+ * @param name Name of data array
+ * @param format Format of image (GRAPH_ImageFormat)
+ * @param palette Name of palette array or null
+ * @param key Transparent index or -1
+ */
+static void CONV_WriteEpilogue(FILE* out, const CONV_Image* img,
+    const char* name, const char* format, const char* palette, int key) {
+
+  char guard[80];
+
+  snprintf(guard, sizeof(guard), "INC_%s_H_", name);
+  for (int i = 0; guard[i]; i++) {
+    guard[i] = toupper((unsigned char)guard[i]);
+  }
+
+  fprintf(out,
+      "\n"
+      "static const GRAPH_ImageStruct %sImage = {\n"
+      "    %s,\n"
+      "    %d,\n"
+      "    %d,\n"
+      "    %s,\n"
+      "    %s,\n"
+      "    %d,\n"
+      "    %d\n"
+      "};\n"
+      "\n"
+      "#endif /* %s */\n",
+      name, name, img->height, img->width, format, palette ? palette : "0",
+      key >= 0, key >= 0 ? key : 0, guard);
+}
+/**
+ * @brief Reads a little endian 32 bit value.
+ * @param p Bytes
+ * @return Value
+ */
+static uint32_t CONV_Get32(const uint8_t* p) {
+
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+/**
+ * @brief Reads a little endian 16 bit value.
+ * @param p Bytes
+ * @return Value
+ */
+static uint16_t CONV_Get16(const uint8_t* p) {
+
+  return p[0] | (p[1] << 8);
+}